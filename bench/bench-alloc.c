@@ -0,0 +1,108 @@
+// Heap allocations per caption: the encoder chain on a heap Buffer,
+// where every header prepended is a malloc(), against the arena with
+// reserved headroom, and the whole caption path from an input line to
+// TS packets, which should need none at all once the arena is warm.
+// The caption path also reports the bytes it copies per caption.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "caption.h"
+#include "stats.h"
+
+#include "bench.h"
+
+#define TEXT_SIZE 64
+
+// Captions encoded again to count the bytes copied, after timing.
+#define COPY_SAMPLE 1000
+
+static const uint8_t text[TEXT_SIZE] = "Legenda de exemplo, com o tamanho "
+	"de uma linha comum na tela.";
+
+struct Alloc
+{
+	DataGroupStream dg;
+	CaptionStream cs;
+	Arena arena;
+};
+typedef struct Alloc Alloc;
+
+static void heap(void *par, const uint64_t n)
+{
+	Alloc *a = par;
+	for(uint64_t i = 0; i < n; ++i) {
+		Buffer data;
+		memcpy(buffer_init(&data, TEXT_SIZE), text, TEXT_SIZE);
+		data_unit(&a->dg, STATEMENT_1, STATEMENT_BODY, &data);
+		buffer_destroy(&data);
+	}
+}
+
+static void arena(void *par, const uint64_t n)
+{
+	Alloc *a = par;
+	for(uint64_t i = 0; i < n; ++i) {
+		Buffer data;
+		memcpy(buffer_init_reserved(&data, &a->arena, TEXT_SIZE, 128, 2),
+			text, TEXT_SIZE);
+		data_unit(&a->dg, STATEMENT_1, STATEMENT_BODY, &data);
+		buffer_destroy(&data);
+		arena_reset(&a->arena);
+	}
+}
+
+static void caption(void *par, const uint64_t n)
+{
+	Alloc *a = par;
+	static const char line[] = "Legenda de exemplo, com acentuação.\n";
+	for(uint64_t i = 0; i < n; ++i) {
+		Buffer pes;
+		caption_set_time(&a->cs, i);
+		if(caption_push_line(&a->cs, &a->arena, line, sizeof line - 1, &pes)) {
+			while(buffer_get_size(&pes)) {
+				Buffer wire;
+				caption_next_packet(&a->cs, &a->arena, &pes, &wire);
+				buffer_destroy(&wire);
+			}
+			buffer_destroy(&pes);
+		}
+		arena_reset(&a->arena);
+	}
+}
+
+static void alloc_case(const char *name, const BenchFunc fn,
+	const bool ts_output)
+{
+	static Alloc a;
+	memset(&a, 0, sizeof a);
+	a.dg.pes.pts_source = PTS_CUE;
+
+	CaptionConfig config = CAPTION_CONFIG_DEFAULT;
+	config.lines = 1;
+	config.ts_output = ts_output;
+	config.pts_source = PTS_CUE;
+	caption_stream_init(&a.cs, &config);
+
+	const BenchRun run = bench_run(fn, &a);
+	const uint64_t copied = stats_counter(STATS_COPIED_BYTES);
+	fn(&a, COPY_SAMPLE);
+	bench_report("alloc", name,
+		"allocs_per_caption", (double)run.allocations / run.iterations,
+		"ns_per_caption", run.seconds * 1e9 / run.iterations,
+		"copied_bytes_per_caption",
+		(double)(stats_counter(STATS_COPIED_BYTES) - copied) / COPY_SAMPLE,
+		(const char *)NULL);
+
+	caption_stream_destroy(&a.cs);
+	arena_free(&a.arena);
+}
+
+void bench_alloc(void)
+{
+	alloc_case("heap", heap, true);
+	alloc_case("arena", arena, true);
+	alloc_case("caption", caption, true);
+	alloc_case("caption-pes", caption, false);
+}
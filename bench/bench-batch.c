@@ -0,0 +1,100 @@
+// Batch encoding of a catalog of subtitle files on 1 to N threads, N
+// the number of CPUs online or BENCH_THREADS in the environment, with
+// the speedup over one thread.
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "batch.h"
+
+#include "bench.h"
+
+#define FILES 64
+#define CUES 2000
+
+static const char *const texts[] = {
+	"Começa agora o jornal da noite,",
+	"com as notícias do dia.",
+	"[música]",
+	"O ministro falou com a imprensa hoje de manhã.",
+};
+
+// Writes a film's worth of SRT cues to path.
+static int write_srt(const char *path)
+{
+	FILE *f = fopen(path, "w");
+	if(!f) {
+		perror(path);
+		return -1;
+	}
+	for(unsigned i = 0; i < CUES; ++i) {
+		const unsigned start = i * 2500, end = start + 2000;
+		fprintf(f, "%u\n%02u:%02u:%02u,%03u --> %02u:%02u:%02u,%03u\n"
+			"%s\n%s\n\n", i + 1,
+			start / 3600000, start / 60000 % 60, start / 1000 % 60, start % 1000,
+			end / 3600000, end / 60000 % 60, end / 1000 % 60, end % 1000,
+			texts[i % 4], texts[(i + 1) % 4]);
+	}
+	return fclose(f);
+}
+
+void bench_batch(void)
+{
+	char dir[] = "/tmp/bench-batch-XXXXXX";
+	if(!mkdtemp(dir)) {
+		perror("mkdtemp");
+		return;
+	}
+
+	static char names[FILES][2][64];
+	BatchJob jobs[FILES];
+	for(unsigned i = 0; i < FILES; ++i) {
+		snprintf(names[i][0], sizeof names[i][0], "%s/%u.srt", dir, i);
+		snprintf(names[i][1], sizeof names[i][1], "%s/%u.pes", dir, i);
+		if(write_srt(names[i][0]) < 0) {
+			return;
+		}
+		jobs[i] = (BatchJob){.in = names[i][0], .out = names[i][1]};
+	}
+
+	CaptionConfig config = CAPTION_CONFIG_DEFAULT;
+	const char *env = getenv("BENCH_THREADS");
+	long cpus = env ? atol(env) : sysconf(_SC_NPROCESSORS_ONLN);
+	if(cpus < 1) {
+		cpus = 1;
+	}
+	double single = 0;
+	for(long threads = 1;; threads *= 2) {
+		if(threads > cpus) {
+			threads = cpus;
+		}
+		// The first run warms the page cache.
+		batch_run_all(&config, jobs, FILES, threads);
+		const double start = bench_now();
+		batch_run_all(&config, jobs, FILES, threads);
+		const double seconds = bench_now() - start;
+		if(threads == 1) {
+			single = seconds;
+		}
+
+		char name[32];
+		snprintf(name, sizeof name, "threads-%ld", threads);
+		bench_report("batch", name,
+			"files_per_sec", FILES / seconds,
+			"cues_per_sec", (double)FILES * CUES / seconds,
+			"speedup", single / seconds,
+			(const char *)NULL);
+		if(threads == cpus) {
+			break;
+		}
+	}
+
+	for(unsigned i = 0; i < FILES; ++i) {
+		unlink(names[i][0]);
+		unlink(names[i][1]);
+	}
+	rmdir(dir);
+}
@@ -0,0 +1,60 @@
+// Throughput of the encoder chain on payloads of several megabytes,
+// as big DRCS or bitmap data units would be, carried by chains of
+// data groups a PES packet each.
+
+#include <stdio.h>
+
+#include "data-group.h"
+
+#include "bench.h"
+
+// Up to about the longest chain, of 256 data groups.
+static const size_t sizes[] = {1 << 20, 2 << 20, 4 << 20, 8000 << 10};
+#define NSIZES (sizeof sizes / sizeof sizes[0])
+
+static uint8_t payload[8000 << 10];
+
+struct Chain
+{
+	DataGroupStream dg;
+	Arena arena;
+	size_t size;
+	size_t encoded;
+};
+typedef struct Chain Chain;
+
+static void chain_run(void *par, const uint64_t n)
+{
+	Chain *c = par;
+	for(uint64_t i = 0; i < n; ++i) {
+		// Referenced, not copied: the copy would be the caller's.
+		Buffer data = {.arena = &c->arena};
+		buffer_prepend_ref(&data, payload, c->size);
+		data_unit(&c->dg, STATEMENT_1, BIT_MAP, &data);
+		c->encoded = buffer_get_size(&data);
+		buffer_destroy(&data);
+		arena_reset(&c->arena);
+	}
+}
+
+void bench_chain(void)
+{
+	for(size_t i = 0; i < sizeof payload; ++i) {
+		payload[i] = i * 7 + (i >> 11);
+	}
+
+	for(size_t i = 0; i < NSIZES; ++i) {
+		Chain c = {.dg.pes.pts_source = PTS_CUE, .size = sizes[i]};
+		const BenchRun run = bench_run(chain_run, &c);
+
+		char name[32];
+		snprintf(name, sizeof name, "%zu-kb", sizes[i] >> 10);
+		bench_report("chain", name,
+			"mb_per_sec", run.iterations * sizes[i] / run.seconds * 1e-6,
+			"ms_per_payload", run.seconds * 1e3 / run.iterations,
+			"allocs_per_payload", (double)run.allocations / run.iterations,
+			"pes_bytes", (double)c.encoded,
+			(const char *)NULL);
+		arena_free(&c.arena);
+	}
+}
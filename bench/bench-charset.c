@@ -0,0 +1,74 @@
+// Conversion of caption lines from UTF-8: charset_encode() against
+// the iconv() to Latin-1 every line used to go through, which has no
+// way to carry Japanese at all.
+
+#include <iconv.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "charset.h"
+
+#include "bench.h"
+
+static const char portuguese[] = "Começa agora o jornal da noite, com as "
+	"notícias do dia: a economia, a política e o tempo.\n";
+static const char japanese[] = "今日のニュースをお伝えします。天気は晴れです。\n";
+
+struct Charset
+{
+	const char *text;
+	size_t size;
+	iconv_t cd;
+	uint8_t out[1024];
+	size_t encoded;
+};
+typedef struct Charset Charset;
+
+static void native(void *par, const uint64_t n)
+{
+	Charset *c = par;
+	for(uint64_t i = 0; i < n; ++i) {
+		CharsetState state;
+		charset_reset(&state);
+		c->encoded = charset_encode(&state, c->text, c->size,
+			c->out, sizeof c->out);
+	}
+}
+
+static void latin1(void *par, const uint64_t n)
+{
+	Charset *c = par;
+	for(uint64_t i = 0; i < n; ++i) {
+		char *in = (char *)c->text, *o = (char *)c->out;
+		size_t in_size = c->size, out_size = sizeof c->out;
+		iconv(c->cd, &in, &in_size, &o, &out_size);
+		iconv(c->cd, NULL, NULL, NULL, NULL);
+		c->encoded = sizeof c->out - out_size;
+	}
+}
+
+static void charset_case(const char *name, const char *text,
+	const BenchFunc fn, iconv_t cd)
+{
+	Charset c = {.text = text, .size = strlen(text), .cd = cd};
+	const BenchRun run = bench_run(fn, &c);
+	bench_report("charset", name,
+		"lines_per_sec", run.iterations / run.seconds,
+		"mb_per_sec", run.iterations * c.size / run.seconds * 1e-6,
+		"bytes_out", (double)c.encoded,
+		(const char *)NULL);
+}
+
+void bench_charset(void)
+{
+	charset_case("native-portuguese", portuguese, native, NULL);
+	charset_case("native-japanese", japanese, native, NULL);
+
+	iconv_t cd = iconv_open("l1", "utf8");
+	if(cd == (iconv_t)-1) {
+		perror("iconv_open");
+		return;
+	}
+	charset_case("iconv-latin1-portuguese", portuguese, latin1, cd);
+	iconv_close(cd);
+}
@@ -0,0 +1,60 @@
+// Every CRC-16 implementation, on blocks from a small caption to the
+// largest data group.
+
+#include <stdio.h>
+
+#include "crc.h"
+
+#include "bench.h"
+
+static const size_t sizes[] = {64, 256, 1024, 4096, 16384, 65536};
+#define NSIZES (sizeof sizes / sizeof sizes[0])
+
+struct CRCCase
+{
+	CRC16Func func;
+	size_t size;
+	// Kept so the calls can't be optimized away.
+	uint16_t crc;
+};
+typedef struct CRCCase CRCCase;
+
+static uint8_t block[65536];
+
+static void crc_run(void *par, const uint64_t n)
+{
+	CRCCase *c = par;
+	for(uint64_t i = 0; i < n; ++i) {
+		c->crc = c->func(c->crc, block, c->size);
+	}
+}
+
+static void crc_variant(const char *variant, const CRC16Func func)
+{
+	for(size_t i = 0; i < NSIZES; ++i) {
+		CRCCase c = {.func = func, .size = sizes[i]};
+		const BenchRun run = bench_run(crc_run, &c);
+
+		char name[64];
+		snprintf(name, sizeof name, "%s-%zu", variant, sizes[i]);
+		bench_report("crc", name,
+			"mb_per_sec", run.iterations * sizes[i] / run.seconds * 1e-6,
+			"ns_per_call", run.seconds * 1e9 / run.iterations,
+			(const char *)NULL);
+	}
+}
+
+void bench_crc(void)
+{
+	for(size_t i = 0; i < sizeof block; ++i) {
+		block[i] = i * 131 + (i >> 8);
+	}
+
+	crc_variant("bitwise", crc16_update_bitwise);
+	crc_variant("slice8", crc16_update_slice8);
+	const CRC16Func clmul = crc16_clmul_func();
+	if(clmul) {
+		crc_variant("clmul", clmul);
+	}
+	crc_variant("dispatch", crc16_update);
+}
@@ -0,0 +1,96 @@
+// Encoder chain alone: data_unit() down to PES packets, for captions
+// of several sizes, and caption_management_data(). Input is already
+// in the ARIB character set, so this is all encoding.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "data-group.h"
+
+#include "bench.h"
+
+// Room around the payload for headers and CRC, as caption.c reserves.
+#define HEADROOM 128
+#define TAILROOM 2
+
+static const size_t sizes[] = {16, 64, 256, 1024, 4096};
+#define NSIZES (sizeof sizes / sizeof sizes[0])
+
+struct Encoder
+{
+	DataGroupStream dg;
+	Arena arena;
+	uint8_t text[4096];
+	size_t size;
+	// Bytes of PES encoded per caption.
+	size_t encoded;
+};
+typedef struct Encoder Encoder;
+
+static void encoder_init(Encoder *e, const size_t size)
+{
+	memset(e, 0, sizeof *e);
+	e->dg.pes.pts_source = PTS_CUE;
+	e->size = size;
+	for(size_t i = 0; i < size; ++i) {
+		e->text[i] = 0x21 + i % 94;
+	}
+}
+
+static void statement(void *par, const uint64_t n)
+{
+	Encoder *e = par;
+	for(uint64_t i = 0; i < n; ++i) {
+		Buffer data;
+		uint8_t *to = buffer_init_reserved(&data, &e->arena, e->size,
+			HEADROOM, TAILROOM);
+		memcpy(to, e->text, e->size);
+		data_unit(&e->dg, STATEMENT_1, STATEMENT_BODY, &data);
+		e->encoded = buffer_get_size(&data);
+		buffer_destroy(&data);
+		arena_reset(&e->arena);
+	}
+}
+
+static void management(void *par, const uint64_t n)
+{
+	Encoder *e = par;
+	for(uint64_t i = 0; i < n; ++i) {
+		Buffer data;
+		buffer_init_reserved(&data, &e->arena, 0, HEADROOM, TAILROOM);
+		caption_management_data(&e->dg, OLD_MANAGEMENT, &data);
+		e->encoded = buffer_get_size(&data);
+		buffer_destroy(&data);
+		arena_reset(&e->arena);
+	}
+}
+
+static void report(const char *name, Encoder *e, const BenchRun *run)
+{
+	bench_report("encoder", name,
+		"captions_per_sec", run->iterations / run->seconds,
+		"ns_per_caption", run->seconds * 1e9 / run->iterations,
+		"allocs_per_caption", (double)run->allocations / run->iterations,
+		"pes_bytes", (double)e->encoded,
+		(const char *)NULL);
+}
+
+void bench_encoder(void)
+{
+	static Encoder e;
+	for(size_t i = 0; i < NSIZES; ++i) {
+		encoder_init(&e, sizes[i]);
+		const BenchRun run = bench_run(statement, &e);
+
+		char name[32];
+		snprintf(name, sizeof name, "statement-%zu", sizes[i]);
+		report(name, &e, &run);
+		free(e.arena.base);
+	}
+
+	encoder_init(&e, 0);
+	const BenchRun run = bench_run(management, &e);
+	report("management", &e, &run);
+	free(e.arena.base);
+}
@@ -0,0 +1,133 @@
+// Input lines per second through a pipe, as a muxer would feed them:
+// a synthetic transcript of a few gigabytes, written by a child
+// process, split by LineReader against getline() on a FILE.
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "caption.h"
+#include "line-reader.h"
+
+#include "bench.h"
+
+#define TRANSCRIPT_SIZE (UINT64_C(2) << 30)
+
+static const char *const samples[] = {
+	"Boa noite.\n",
+	"Começa agora o jornal da noite, com as notícias do dia.\n",
+	"\n",
+	"[música]\n",
+	"O presidente anunciou hoje as novas medidas econômicas.\n",
+	"Segundo o ministro, elas entram em vigor na semana que vem.\n",
+};
+#define NSAMPLES (sizeof samples / sizeof samples[0])
+
+// Starts a child writing TRANSCRIPT_SIZE bytes of lines to a pipe,
+// and returns its read end.
+static int transcript(pid_t *pid)
+{
+	int fds[2];
+	if(pipe(fds) < 0) {
+		perror("pipe");
+		return -1;
+	}
+
+	*pid = fork();
+	if(*pid < 0) {
+		perror("fork");
+		return -1;
+	}
+	if(*pid > 0) {
+		close(fds[1]);
+		return fds[0];
+	}
+
+	close(fds[0]);
+	static char block[LINE_READER_BLOCK];
+	size_t size = 0;
+	for(size_t i = 0;; i = (i + 1) % NSAMPLES) {
+		const size_t n = strlen(samples[i]);
+		if(size + n > sizeof block) {
+			break;
+		}
+		memcpy(block + size, samples[i], n);
+		size += n;
+	}
+	for(uint64_t sent = 0; sent < TRANSCRIPT_SIZE; sent += size) {
+		size_t done = 0;
+		while(done < size) {
+			const ssize_t n = write(fds[1], block + done, size - done);
+			if(n < 0) {
+				_exit(1);
+			}
+			done += n;
+		}
+	}
+	_exit(0);
+}
+
+static uint64_t line_reader_lines(const int fd, uint64_t *bytes)
+{
+	LineReader r;
+	line_reader_init(&r, fd, CAPTION_MAX_TEXT);
+	uint64_t lines = 0;
+	while(!r.eof) {
+		line_reader_fill(&r);
+		LineView line;
+		while(line_reader_next(&r, &line)) {
+			*bytes += line.size;
+			++lines;
+		}
+	}
+	line_reader_destroy(&r);
+	return lines;
+}
+
+static uint64_t getline_lines(const int fd, uint64_t *bytes)
+{
+	FILE *in = fdopen(dup(fd), "r");
+	char *line = NULL;
+	size_t capacity = 0;
+	ssize_t n;
+	uint64_t lines = 0;
+	while((n = getline(&line, &capacity, in)) > 0) {
+		*bytes += n;
+		++lines;
+	}
+	free(line);
+	fclose(in);
+	return lines;
+}
+
+static void reader_case(const char *name,
+	uint64_t (*read_lines)(int fd, uint64_t *bytes))
+{
+	pid_t pid;
+	const int fd = transcript(&pid);
+	if(fd < 0) {
+		return;
+	}
+
+	uint64_t bytes = 0;
+	const double start = bench_now();
+	const uint64_t lines = read_lines(fd, &bytes);
+	const double seconds = bench_now() - start;
+	close(fd);
+	waitpid(pid, NULL, 0);
+
+	bench_report("line-reader", name,
+		"lines_per_sec", lines / seconds,
+		"mb_per_sec", bytes / seconds * 1e-6,
+		"bytes", (double)bytes,
+		(const char *)NULL);
+}
+
+void bench_line_reader(void)
+{
+	reader_case("line-reader", line_reader_lines);
+	reader_case("getline", getline_lines);
+}
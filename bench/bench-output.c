@@ -0,0 +1,94 @@
+// The output queue writing to a pipe with each backend, from a small
+// caption to a large packet: system calls per packet, and time from a
+// packet being pushed to it being written.
+
+#define _GNU_SOURCE
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "output.h"
+
+#include "bench.h"
+
+static const size_t sizes[] = {256, 4096, 65536};
+#define NSIZES (sizeof sizes / sizeof sizes[0])
+
+struct OutputCase
+{
+	OutputBackend backend;
+	int fd;
+	Buffer packet;
+	// Of the last run.
+	OutputStats stats;
+};
+typedef struct OutputCase OutputCase;
+
+// Empties the pipe as fast as it's filled, like a muxer would.
+static void *drain(void *par)
+{
+	const int fd = *(int *)par;
+	static uint8_t sink[65536];
+	while(read(fd, sink, sizeof sink) > 0)
+		;
+	return NULL;
+}
+
+static void output_run(void *par, const uint64_t n)
+{
+	OutputCase *c = par;
+	OutputQueue *q = malloc(sizeof *q);
+	if(output_queue_start(q, c->fd, c->backend) < 0) {
+		exit(1);
+	}
+	for(uint64_t i = 0; i < n; ++i) {
+		output_queue_push(q, &c->packet);
+	}
+	output_queue_close(q);
+	output_queue_stats(q, &c->stats);
+	free(q);
+}
+
+void bench_output(void)
+{
+	int pipefd[2];
+	if(pipe(pipefd) < 0) {
+		perror("pipe");
+		return;
+	}
+	pthread_t drainer;
+	pthread_create(&drainer, NULL, drain, &pipefd[0]);
+
+	static const OutputBackend backends[] = {OUTPUT_WRITEV, OUTPUT_URING};
+	for(size_t b = 0; b < 2; ++b) {
+		for(size_t i = 0; i < NSIZES; ++i) {
+			OutputCase c = {.backend = backends[b], .fd = pipefd[1]};
+			Arena arena = {0};
+			memset(buffer_init_reserved(&c.packet, &arena, sizes[i], 0, 0),
+				0x5a, sizes[i]);
+			const BenchRun run = bench_run(output_run, &c);
+			buffer_destroy(&c.packet);
+			arena_free(&arena);
+
+			// A backend that fell back is reported as what it was.
+			char name[64];
+			snprintf(name, sizeof name, "%s-%zu",
+				c.stats.backend == OUTPUT_URING ? "io_uring" : "writev",
+				sizes[i]);
+			const double packets = c.stats.packets ? c.stats.packets : 1;
+			bench_report("output", name,
+				"packets_per_sec", run.iterations / run.seconds,
+				"mb_per_sec", run.iterations * sizes[i] / run.seconds * 1e-6,
+				"syscalls_per_packet", c.stats.syscalls / packets,
+				"latency_us", c.stats.mean_latency * 1e6,
+				"dropped", (double)c.stats.dropped,
+				(const char *)NULL);
+		}
+	}
+
+	close(pipefd[1]);
+	pthread_join(drainer, NULL);
+	close(pipefd[0]);
+}
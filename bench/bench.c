@@ -0,0 +1,109 @@
+// Benchmarks of the encoder chain, run by make bench.
+//
+//	make bench
+//	build/bench [name...]
+//
+// Prints one JSON object per case, one per line, to be kept and
+// compared over time. BENCH_TIME in the environment sets how many
+// seconds a timed run takes at least, 0.2 by default.
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "buffer.h"
+
+#include "bench.h"
+
+#define BENCH_DEFAULT_TIME 0.2
+
+struct Bench
+{
+	const char *name;
+	void (*run)(void);
+};
+typedef struct Bench Bench;
+
+static const Bench benches[] = {
+	{"alloc", bench_alloc},
+	{"batch", bench_batch},
+	{"chain", bench_chain},
+	{"charset", bench_charset},
+	{"crc", bench_crc},
+	{"encoder", bench_encoder},
+	{"line-reader", bench_line_reader},
+	{"output", bench_output},
+};
+#define NBENCHES (sizeof benches / sizeof benches[0])
+
+static double min_time = BENCH_DEFAULT_TIME;
+
+double bench_now(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+BenchRun bench_run(BenchFunc fn, void *par)
+{
+	BenchRun run = {.iterations = 1};
+	for(;; run.iterations *= 2) {
+		const size_t allocations = buffer_allocations();
+		const double start = bench_now();
+		fn(par, run.iterations);
+		run.seconds = bench_now() - start;
+		run.allocations = buffer_allocations() - allocations;
+		if(run.seconds >= min_time) {
+			return run;
+		}
+	}
+}
+
+void bench_report(const char *bench, const char *name, ...)
+{
+	printf("{\"bench\": \"%s\", \"case\": \"%s\"", bench, name);
+
+	va_list ap;
+	va_start(ap, name);
+	const char *key;
+	while((key = va_arg(ap, const char *))) {
+		printf(", \"%s\": %.6g", key, va_arg(ap, double));
+	}
+	va_end(ap);
+
+	printf("}\n");
+	fflush(stdout);
+}
+
+static bool selected(const char *name, int argc, char *argv[])
+{
+	if(argc < 2) {
+		return true;
+	}
+	for(int i = 1; i < argc; ++i) {
+		if(strcmp(argv[i], name) == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+int main(int argc, char *argv[])
+{
+	const char *time = getenv("BENCH_TIME");
+	if(time) {
+		min_time = atof(time);
+	}
+
+	for(size_t i = 0; i < NBENCHES; ++i) {
+		if(selected(benches[i].name, argc, argv)) {
+			benches[i].run();
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Runs of a case, timed together.
+struct BenchRun
+{
+	uint64_t iterations;
+	double seconds;
+	// Heap allocations of the buffer module during the run.
+	size_t allocations;
+};
+typedef struct BenchRun BenchRun;
+
+// Runs n iterations of a case.
+typedef void (*BenchFunc)(void *par, uint64_t n);
+
+//! Seconds of a monotonic clock.
+double bench_now(void);
+
+//! Runs fn with twice as many iterations each time, until a run takes
+//! long enough to be timed, and returns that run. The ones before it
+//! warm up caches and arenas.
+BenchRun bench_run(BenchFunc fn, void *par);
+
+//! Prints a result as one JSON object on a line: the benchmark, the
+//! case and then name/value pairs of doubles, ended by NULL.
+void bench_report(const char *bench, const char *name, ...);
+
+// Benchmarks, one per bench file.
+void bench_alloc(void);
+void bench_batch(void);
+void bench_chain(void);
+void bench_charset(void);
+void bench_crc(void);
+void bench_encoder(void);
+void bench_line_reader(void);
+void bench_output(void);
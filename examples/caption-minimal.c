@@ -0,0 +1,48 @@
+// Smallest use of libaribwrite, through its public header alone:
+// writes a few captions, with cue times, as PES packets to stdout.
+//
+//	make example
+//	examples/caption-minimal > captions.pes
+
+#include <stdio.h>
+#include <string.h>
+
+#include "arib-writer.h"
+
+static int write_packet(void *par, const struct iovec *iov, int iovcnt)
+{
+	FILE *out = par;
+	for(int i = 0; i < iovcnt; ++i) {
+		if(fwrite(iov[i].iov_base, 1, iov[i].iov_len, out) != iov[i].iov_len) {
+			return -1;
+		}
+	}
+	return 0;
+}
+
+int main(void)
+{
+	static const char *const lines[] = {
+		"Boa noite.\n",
+		"Começa agora o jornal.\n",
+	};
+
+	AribWriterConfig config = ARIB_WRITER_CONFIG_DEFAULT;
+	config.lines = 1;
+	config.pts_source = ARIB_PTS_CUE;
+
+	AribWriter *w = arib_writer_new(&config, write_packet, stdout);
+	if(!w) {
+		return 1;
+	}
+	int ret = arib_writer_management(w);
+	for(size_t i = 0; i < sizeof lines / sizeof *lines; ++i) {
+		arib_writer_set_time(w, 1000 * (i + 1));
+		ret |= arib_writer_push_line(w, lines[i], strlen(lines[i]));
+	}
+	arib_writer_set_time(w, 3000);
+	ret |= arib_writer_clear(w);
+	arib_writer_free(w);
+
+	return ret < 0 || fflush(stdout) != 0;
+}
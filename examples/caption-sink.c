@@ -0,0 +1,165 @@
+// Encodes captions in-process with libaribwrite, straight into the TS
+// packet buffer of a would-be muxer, and times it. Given the path of
+// the arib-write binary, also times the same captions going through
+// it over pipes, the way a muxer would have to without the library.
+//
+//	make example
+//	examples/caption-sink [./arib-write]
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "arib-writer.h"
+
+#define CAPTIONS 20
+#define TS_PACKET_SIZE 188
+
+static double now(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// TS packets of the muxer, filled by the sink.
+struct Mux
+{
+	uint8_t packets[64][TS_PACKET_SIZE];
+	size_t count;
+	double sent;
+};
+typedef struct Mux Mux;
+
+static int mux_sink(void *par, const struct iovec *iov, int iovcnt)
+{
+	Mux *mux = par;
+	uint8_t *to = mux->packets[mux->count];
+	const uint8_t *end = mux->packets[64];
+	for(int i = 0; i < iovcnt; ++i) {
+		if(to + iov[i].iov_len > end) {
+			return -1;
+		}
+		memcpy(to, iov[i].iov_base, iov[i].iov_len);
+		to += iov[i].iov_len;
+	}
+	mux->count = (to - mux->packets[0]) / TS_PACKET_SIZE;
+	mux->sent = now();
+	return 0;
+}
+
+static void library_latency(void)
+{
+	AribWriterConfig config = ARIB_WRITER_CONFIG_DEFAULT;
+	config.ts_output = true;
+	config.lines = 1;
+
+	Mux mux = {0};
+	AribWriter *w = arib_writer_new(&config, mux_sink, &mux);
+	arib_writer_management(w);
+
+	double total = 0, max = 0;
+	for(int i = 0; i < CAPTIONS; ++i) {
+		char line[64];
+		const int size = sprintf(line, "Caption number %d\n", i);
+
+		mux.count = 0;
+		const double start = now();
+		arib_writer_push_line(w, line, size);
+		const double latency = mux.sent - start;
+		total += latency;
+		if(latency > max) {
+			max = latency;
+		}
+	}
+	arib_writer_free(w);
+
+	printf("library: mean %.3f us, max %.3f us per caption\n",
+		total / CAPTIONS * 1e6, max * 1e6);
+}
+
+// Reads PES packets from fd until one carries a caption statement.
+static int read_statement(int fd)
+{
+	for(;;) {
+		uint8_t pes[65536 + 6];
+		size_t got = 0, need = 6;
+		while(got < need) {
+			const ssize_t n = read(fd, pes + got, need - got);
+			if(n <= 0) {
+				return -1;
+			}
+			got += n;
+			if(got == 6) {
+				need = 6 + (pes[4] << 8 | pes[5]);
+			}
+		}
+		// data_group_id, past the 35 bytes of PES header: 0 or
+		// 0x20 for management data.
+		if((pes[35] >> 2) & 0x0f) {
+			return 0;
+		}
+	}
+}
+
+static void pipe_latency(const char *binary)
+{
+	int in[2], out[2];
+	if(pipe(in) < 0 || pipe(out) < 0) {
+		perror("pipe");
+		return;
+	}
+
+	const pid_t pid = fork();
+	if(pid == 0) {
+		dup2(in[0], STDIN_FILENO);
+		dup2(out[1], STDOUT_FILENO);
+		close(in[1]);
+		close(out[0]);
+		execl(binary, binary, "--lines", "1", (char *)NULL);
+		perror("exec");
+		_exit(1);
+	}
+	close(in[0]);
+	close(out[1]);
+
+	double total = 0, max = 0;
+	int done = 0;
+	for(; done < CAPTIONS; ++done) {
+		char line[64];
+		const int size = sprintf(line, "Caption number %d\n", done);
+
+		// Past the minimum interval between PES packets.
+		nanosleep(&(struct timespec){.tv_nsec = 200000000}, NULL);
+		const double start = now();
+		if(write(in[1], line, size) != size || read_statement(out[0]) < 0) {
+			break;
+		}
+		const double latency = now() - start;
+		total += latency;
+		if(latency > max) {
+			max = latency;
+		}
+	}
+	close(in[1]);
+	close(out[0]);
+	waitpid(pid, NULL, 0);
+
+	if(done) {
+		printf("pipe:    mean %.3f us, max %.3f us per caption\n",
+			total / done * 1e6, max * 1e6);
+	}
+}
+
+int main(int argc, char *argv[])
+{
+	library_latency();
+	if(argc > 1) {
+		pipe_latency(argv[1]);
+	}
+	return 0;
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/uio.h>
+
+// Entry point of libaribwrite: the caption encoder without the server,
+// handing every encoded packet to a callback instead of a file. This
+// is all the library exports; everything else is internal.
+//
+// Packets go to the sink as soon as they're encoded. ARIB TR-B14 wants
+// caption PES packets at least 100 ms apart, which arib-write's server
+// enforces and the library doesn't: the caller spaces its calls, or
+// the packets it hands on, and their PTS accordingly.
+
+#if defined(__GNUC__)
+#define ARIB_WRITER_API __attribute__((visibility("default")))
+#else
+#define ARIB_WRITER_API
+#endif
+
+// Caption management data is due once every this many seconds.
+#define ARIB_MANAGEMENT_INTERVAL 1.0
+
+// Most lines of text per caption.
+#define ARIB_MAX_LINES 51
+
+enum AribSegType
+{
+	ARIB_FULL_SEG,
+	ARIB_ONE_SEG,
+};
+typedef enum AribSegType AribSegType;
+
+// Where the PTS of the captions comes from.
+enum AribPTSSource
+{
+	// Time since the first packet was encoded.
+	ARIB_PTS_WALL_CLOCK,
+	// Timecodes "HH:MM:SS[.mmm] " at the start of the first line of
+	// a caption.
+	ARIB_PTS_TIMECODE,
+	// arib_writer_set_time(), before each caption.
+	ARIB_PTS_CUE,
+};
+typedef enum AribPTSSource AribPTSSource;
+
+// Settings of a caption stream, as arib-write takes them from its
+// command line.
+struct AribWriterConfig
+{
+	AribSegType seg_type;
+
+	// Set Display Position, with ARIB_FULL_SEG, 0 to 999.
+	int sdp_x, sdp_y;
+
+	// Lines of text per caption, 1 to ARIB_MAX_LINES.
+	int lines;
+
+	// MPEG-TS instead of bare PES, on PID pid, 0x10 to 0x1ffe. Only
+	// caption packets are written: the muxer supplies the PAT, the
+	// PMT and the PCR.
+	bool ts_output;
+	uint16_t pid;
+
+	AribPTSSource pts_source;
+	// PTS of the first packet with ARIB_PTS_WALL_CLOCK, of time 0
+	// otherwise.
+	uint64_t pts_origin;
+};
+typedef struct AribWriterConfig AribWriterConfig;
+
+#define ARIB_WRITER_CONFIG_DEFAULT { \
+	.seg_type = ARIB_FULL_SEG, \
+	.sdp_x = 150, .sdp_y = 350, \
+	.lines = 2, \
+	.ts_output = false, \
+	.pid = 0x100, \
+	.pts_source = ARIB_PTS_WALL_CLOCK, \
+	.pts_origin = 0, \
+}
+
+//! Receives the bytes of one PES packet, or of the TS packets carrying
+//! it, as iovcnt ranges valid only during the call. Returns 0, or -1
+//! to make the call encoding the packet fail.
+typedef int (*AribSink)(void *par, const struct iovec *iov, int iovcnt);
+
+typedef struct AribWriter AribWriter;
+
+//! Encoder of one caption stream, handing packets to sink, which
+//! mustn't be NULL. Returns NULL with errno set to EINVAL if config
+//! is out of the ranges above, or to ENOMEM if out of memory.
+ARIB_WRITER_API AribWriter *arib_writer_new(const AribWriterConfig *config,
+	AribSink sink, void *par);
+ARIB_WRITER_API void arib_writer_free(AribWriter *w);
+
+//! Adds a line of caption text, with its '\n'. Lines are grouped into
+//! captions as arib-write does with its input, and each caption is sent
+//! to the sink as soon as it's complete.
+ARIB_WRITER_API int arib_writer_push_line(AribWriter *w, const char *line,
+	size_t size);
+
+//! Sends the caption assembled so far, even if short of lines.
+ARIB_WRITER_API int arib_writer_flush(AribWriter *w);
+
+//! Sends a caption with no text, clearing the screen.
+ARIB_WRITER_API int arib_writer_clear(AribWriter *w);
+
+//! Sends the caption management data, due once every
+//! ARIB_MANAGEMENT_INTERVAL.
+ARIB_WRITER_API int arib_writer_management(AribWriter *w);
+
+//! Sets the PTS of what is sent next to ms milliseconds after the
+//! pts_origin of the configuration, unless it's ARIB_PTS_WALL_CLOCK.
+ARIB_WRITER_API void arib_writer_set_time(AribWriter *w, uint64_t ms);
@@ -1,5 +1,4 @@
 
-#include <math.h>
 #include <assert.h>
 #include <arpa/inet.h>
 #include <string.h>
@@ -8,18 +7,16 @@
 
 #include "PES-write.h"
 
-SegType seg_type = FULL_SEG;
-
-static void set_PTS(uint8_t *out)
+static void set_PTS(PESStream *ps, uint8_t *out)
 {
-	static double ref_time = 0.0;
 	uint64_t pts;
-	if(ref_time != 0.0) {
-		const double diff = time_now() - ref_time;
-		pts = round(diff * 90000);
+	if(ps->pts_source != PTS_WALL_CLOCK) {
+		pts = ps->pts;
+	} else if(ps->ref_time != 0.0) {
+		pts = pts_add(ps->pts_origin, time_now() - ps->ref_time);
 	} else {
-		ref_time = time_now();
-		pts = 0;
+		ps->ref_time = time_now();
+		pts = ps->pts_origin;
 	}
 
 	out[0] = 0b00100001 | (0b00001110 & (pts >> 29));
@@ -31,17 +28,12 @@ static void set_PTS(uint8_t *out)
 	out[4] = 1 | (0b11111110 & (pts << 1));
 }
 
-static void PES_packet(Buffer *data)
+static void PES_packet(PESStream *ps, Buffer *data)
 {
 	const size_t payload_size = buffer_get_size(data);
+	assert(payload_size <= PES_MAX_PAYLOAD);
 
-	// According to operating guidelines ARIB TR-B14, Fascicle 2, Section 4.2.2,
-	// PES maximum size must be 32 KB. Since header size must be always 35 bytes
-	// (according to ARIB STD-B37, Section 2.2.3.6 (3)), this leaves for payload:
-	// 32 KB - 35 bytes = 32733 bytes.
-	assert(payload_size <= 32733);
-
-	uint8_t *buf = buffer_prepend(data, 35);
+	uint8_t *buf = buffer_prepend(data, PES_HEADER_SIZE);
 
 	// From ISO 13818-1, section 2.4.3.6, PES packet:
 
@@ -73,7 +65,7 @@ static void PES_packet(Buffer *data)
 	buf[8] = 23;
 
 	// PTS data
-	set_PTS(&buf[9]);
+	set_PTS(ps, &buf[PES_PTS_OFFSET]);
 
 	// PES_private_data_flag (yes), pack_header_field_flags (no),
 	// program_packet_sequence_counter_flag (no), P-STD_buffer_flag (no),
@@ -81,7 +73,7 @@ static void PES_packet(Buffer *data)
 	buf[14] = 0b10001110;
 
 	// PES_private_data, as defined in ABNT NBR 15608-3:2008
-	switch(seg_type) {
+	switch(ps->seg_type) {
 	case FULL_SEG:
 		// Section A.1, unused PES_private_data
 		for(uint8_t i = 15; i < 31; ++i) {
@@ -123,16 +115,30 @@ static void PES_packet(Buffer *data)
 	buf[34] = 0b11110000;
 }
 
-void PES_packetize(Buffer *data)
+void PES_update_PTS(PESStream *ps, uint8_t *packet)
 {
-	/* // TODO fix packetization...
-	while(buffer_get_size(data) > 32733) {
-		Buffer head;
-		buffer_chop_head(data, 32733, &head);
-		PES_packet(&head);
-		buffer_destroy(&head);
-	} */
-
-	assert(buffer_get_size(data) <= 32733);
-	PES_packet(data);
+	set_PTS(ps, &packet[PES_PTS_OFFSET]);
+}
+
+size_t PES_packetized_size(size_t payload_size)
+{
+	return PES_HEADER_SIZE + payload_size;
+}
+
+void PES_packetize(PESStream *ps, Buffer *data)
+{
+	PES_packet(ps, data);
+}
+
+size_t PES_next_packet_size(const Buffer *data)
+{
+	uint8_t h[6];
+	BufferReader r;
+	buffer_reader_init(&r, data);
+	if(buffer_read(&r, h, sizeof h) != sizeof h) {
+		return 0;
+	}
+
+	// packet_start_code_prefix, stream_id and PES_packet_length
+	return sizeof h + ((h[4] << 8) | h[5]);
 }
@@ -4,6 +4,7 @@
 #include <stdint.h>
 
 #include "buffer.h"
+#include "pts.h"
 
 enum SegType
 {
@@ -11,6 +12,51 @@ enum SegType
 	ONE_SEG,
 };
 typedef enum SegType SegType;
-extern SegType seg_type;
 
-void PES_packetize(Buffer *data);
+// State of one caption PES stream.
+struct PESStream
+{
+	SegType seg_type;
+
+	PTSSource pts_source;
+	// PTS of the start of the stream: of the first packet with
+	// PTS_WALL_CLOCK, of time 00:00:00 otherwise.
+	uint64_t pts_origin;
+
+	// Time of the first PES packet, with PTS_WALL_CLOCK.
+	double ref_time;
+	// PTS of the packets encoded next, unless PTS_WALL_CLOCK.
+	uint64_t pts;
+};
+typedef struct PESStream PESStream;
+
+// According to ARIB STD-B37, Section 2.2.3.6 (3), header size is fixed.
+#define PES_HEADER_SIZE 35
+
+// Offset of the 5 PTS bytes in the header.
+#define PES_PTS_OFFSET 9
+
+// According to operating guidelines ARIB TR-B14, Fascicle 2, Section 4.2.2,
+// PES maximum size must be 32 KB, which leaves for payload:
+// 32 KB - 35 bytes = 32733 bytes.
+#define PES_MAX_PAYLOAD (32768 - PES_HEADER_SIZE)
+
+// Also from ARIB TR-B14, Fascicle 2, Section 4.2.2,
+// minimum interval between PES packets, in seconds.
+#define PES_MIN_INTERVAL 0.100
+
+//! Size of the output of PES_packetize() for payload_size bytes of data.
+size_t PES_packetized_size(size_t payload_size);
+
+//! Turns data, one whole data group of at most PES_MAX_PAYLOAD bytes,
+//! into a PES packet. A data group is never split across packets:
+//! bigger data is carried by a chain of data groups.
+void PES_packetize(PESStream *ps, Buffer *data);
+
+//! Sets the PTS of a packet made by PES_packetize() to the current
+//! time. Nothing else in the packet depends on it: the data group CRC
+//! covers only the payload.
+void PES_update_PTS(PESStream *ps, uint8_t *packet);
+
+//! Size of the first PES packet in data, as produced by PES_packetize().
+size_t PES_next_packet_size(const Buffer *data);
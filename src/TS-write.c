@@ -0,0 +1,86 @@
+#include <assert.h>
+#include <string.h>
+
+#include "TS-write.h"
+
+#define TS_HEADER_SIZE 4
+#define TS_PAYLOAD_SIZE (TS_PACKET_SIZE - TS_HEADER_SIZE)
+
+// Number of PES bytes carried in the next TS packet, given how
+// many are still remaining.
+static size_t next_payload(size_t remaining)
+{
+	size_t payload = TS_PAYLOAD_SIZE;
+	if(remaining <= payload) {
+		return remaining;
+	}
+
+	// The PES ends with the data group CRC. Never leave a single
+	// byte for the last TS packet, which would split the CRC bytes
+	// between packets: stuff one more byte in this one instead.
+	if(remaining - payload == 1) {
+		--payload;
+	}
+	return payload;
+}
+
+size_t TS_packetized_size(size_t pes_size)
+{
+	size_t count = 0;
+	while(pes_size) {
+		pes_size -= next_payload(pes_size);
+		++count;
+	}
+	return count * TS_PACKET_SIZE;
+}
+
+void TS_packetize(TSStream *ts, const Buffer *pes, Buffer *out)
+{
+	BufferReader r;
+	buffer_reader_init(&r, pes);
+
+	size_t remaining = pes->total_size;
+	bool first = true;
+	while(remaining) {
+		const size_t payload = next_payload(remaining);
+		const size_t af_size = TS_PAYLOAD_SIZE - payload;
+
+		uint8_t *p = buffer_append(out, TS_PACKET_SIZE);
+
+		// From ISO 13818-1, section 2.4.3.2, Transport Stream packet layer:
+
+		// sync_byte
+		p[0] = 0x47;
+
+		// transport_error_indicator (no), payload_unit_start_indicator,
+		// transport_priority (no), PID
+		p[1] = (first ? 0x40 : 0x00) | (0x1f & (ts->pid >> 8));
+		p[2] = 0xff & ts->pid;
+
+		// transport_scrambling_control (not scrambled),
+		// adaptation_field_control, continuity_counter
+		p[3] = (af_size ? 0b00110000 : 0b00010000)
+			| ts->continuity_counter;
+		ts->continuity_counter = (ts->continuity_counter + 1) & 0x0f;
+
+		// Adaptation field, section 2.4.3.4
+		if(af_size) {
+			// adaptation_field_length
+			p[4] = af_size - 1;
+
+			if(af_size > 1) {
+				// All flags clear
+				p[5] = 0;
+				// stuffing_byte
+				memset(&p[6], 0xff, af_size - 2);
+			}
+		}
+
+		const size_t n = buffer_read(&r, &p[TS_HEADER_SIZE + af_size], payload);
+		assert(n == payload);
+		(void)n;
+
+		remaining -= payload;
+		first = false;
+	}
+}
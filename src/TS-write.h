@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "buffer.h"
+
+#define TS_PACKET_SIZE 188
+
+// State of one elementary stream being carried in MPEG-TS. Only the
+// packets of that stream are written: no PAT or PMT, so the output is
+// meant to be remuxed, and the muxer must supply PSI and a PCR of
+// its own, every 100 ms or less as ISO 13818-1 requires.
+struct TSStream
+{
+	uint16_t pid;
+	uint8_t continuity_counter;
+};
+typedef struct TSStream TSStream;
+
+//! Size of the TS packets TS_packetize() produces from a PES packet
+//! of pes_size bytes.
+size_t TS_packetized_size(size_t pes_size);
+
+//! Splits the PES packet in pes into TS packets, appended to out.
+void TS_packetize(TSStream *ts, const Buffer *pes, Buffer *out);
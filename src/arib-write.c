@@ -1,225 +1,196 @@
-#include <assert.h>
+#define _POSIX_C_SOURCE 199309L
+#include <stdbool.h>
 #include <string.h>
 #include <unistd.h>
 #include <stdio.h>
-#include <pthread.h>
-#include <iconv.h>
 #include <stdlib.h>
-
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#include "batch.h"
+#include "caption.h"
+#include "server.h"
+#include "output.h"
+#include "pts.h"
+#include "stats.h"
 #include "timer.h"
-#include "PES-write.h"
-#include "data-group.h"
+#include "udp-output.h"
 
-static int sdp_x = 150, sdp_y = 350;
+// Single writer of stdout in single-stream mode.
+static OutputQueue output;
 
-// Encodes a control sequence, which are commands
-// preceeded by Control Sequence Introducer (CSI).
-static size_t encode_cs(uint8_t *to, uint8_t final,
-	const char *data)
+// Opens a caption input for the server, "-" being stdin.
+static int open_input(const char *path)
 {
-	size_t i = 0;
-
-	to[i++] = 0x9b;
-	for(; *data; ++data) {
-		to[i++] = *data;
+	if(!strcmp(path, "-")) {
+		return STDIN_FILENO;
 	}
-	to[i++] = 0x20;
-	to[i++] = final;
 
-	return i;
+	// A FIFO is opened for writing too, so it never reaches
+	// end of file when its writers come and go.
+	struct stat st;
+	int flags = O_RDONLY;
+	if(stat(path, &st) == 0 && S_ISFIFO(st.st_mode)) {
+		flags = O_RDWR;
+	}
+	return open(path, flags | O_NONBLOCK);
 }
 
-static void write_caption_management_data(FILE *out)
+static FILE *open_output(const char *path)
 {
-	Buffer data;
-
-	buffer_init(&data, 0);
-	caption_management_data(OLD_MANAGEMENT, &data);
-
-	// This packet should have small fixed size below 184 bytes
-	// and cause no trouble with divided CRC bytes.
-	assert(buffer_get_size(&data) <= 184);
-	buffer_write(&data, out);
-
-	buffer_destroy(&data);
+	if(!strcmp(path, "-")) {
+		return stdout;
+	}
+	return fopen(path, "wb");
 }
 
-static void *caption_writer_thread(void *par)
+// Opens output as a UDP or RTP destination, if it's one of their URLs.
+// Returns NULL otherwise, or with *failed set on error.
+static UdpOutput *open_udp(const char *output, const int ttl,
+	const unsigned ts_per_datagram, bool *failed)
 {
-	FILE *out = par;
-	for(;;) {
-		write_caption_management_data(out);
-		sleep(1);
+	UdpOutput *u = malloc(sizeof *u);
+	const int ret = udp_output_open(u, output, ttl, ts_per_datagram);
+	if(ret != 0) {
+		*failed = ret < 0;
+		free(u);
+		return NULL;
 	}
-	return NULL;
+	*failed = false;
+	return u;
 }
 
-static void subtitle_boilerplate(Buffer *data)
+// Returns -1 if datagrams were dropped.
+static int close_udp(UdpOutput *u, const bool debug)
 {
-	uint8_t *buf;
-	if (seg_type == FULL_SEG)
-	buf = buffer_prepend(data, 50);
-	else
-	buf = buffer_prepend(data, 11);
-//	extern SegType seg_type;
-	size_t i = 0;
-
-	// Control codes are defined in both ABNT NBR 15606-1, Tabela 13
-	// and ARIB STD-B24, Table 7-14.
-	// The semantics are specified in ARIB STD-B24, Table 7-15 and 7-16
-
-	// CS (clear screen)
-	buf[i++] = 0x0c;
-
-
-
-	if (seg_type == FULL_SEG){
-	// The following are commands started by code
-	// CSI (control sequence introducer),
-	// and are defined in ARIB STD-B24, Table 7-17.
-
-	// Set Writing Format (SWF):
-	i += encode_cs(&buf[i], 0x53, "7");
-
-	char sdp[64];
-	sprintf(sdp, "%03d;%03d", sdp_x, sdp_y);
-
-	// Set Display Position (SDP):
-	i += encode_cs(&buf[i], 0x5f, sdp);
-
-	// Set Display Format (SDF):
-	i += encode_cs(&buf[i], 0x56, "500;133");
-
-	// Character composition dot designation (SSM)
-	i += encode_cs(&buf[i], 0x57, "36;36");
-	
-	// Set Horizontal Spacing (SHS):
-	i += encode_cs(&buf[i], 0x58, "2");
-
-	// Set Vertical Spacing (SVS):
-	i += encode_cs(&buf[i], 0x59, "08");
-	
-	// Raster Colour Command (RCS):
-	i += encode_cs(&buf[i], 0x6e, "8");
-
-	// SSZ (small size)
-	buf[i++] = 0x88;
-
-	// WHF (white foreground)
-	buf[i++] = 0x87;
-
-	// COL (colour controls), background color - black
-	buf[i++] = 0x90;
-	buf[i++] = 0x50;
-
-	// APS (active position set), set to (13,0) (0x4d, 0x40)
-	/*buf[i++] = 0x1c;
-	buf[i++] = 0x4d;
-	buf[i++] = 0x40;*/
-
-	assert(i == 50);
-	}else{
-	//87 89 0D 0D 0D 0D 0D 0D 0D 0D 0D
-	
-	// WHF (white foreground)
-        buf[i++] = 0x87;
-	
-	// MSZ (Middle Size)
-        buf[i++] = 0x89;
-
-	buf[i++] = 0X0D;
-	buf[i++] = 0X0D;
-	buf[i++] = 0X0D;
-	buf[i++] = 0X0D;
-
-	buf[i++] = 0X0D;
-	buf[i++] = 0X0D;
-	buf[i++] = 0X0D;
-	buf[i++] = 0X0D;
-	assert(i == 11);
-
+	if(debug) {
+		fprintf(stderr, "UDP: %llu datagrams in %llu sendmmsg calls\n",
+			(unsigned long long)u->datagrams,
+			(unsigned long long)u->send_calls);
 	}
-
-	data_unit(STATEMENT_1, STATEMENT_BODY, data);
+	const int ret = u->dropped ? -1 : 0;
+	if(ret < 0) {
+		fprintf(stderr, "UDP: %llu datagrams dropped after a send error\n",
+			(unsigned long long)u->dropped);
+	}
+	udp_output_close(u);
+	free(u);
+	return ret;
 }
 
-static void write_full_subtitle(FILE *out,
-	const size_t msg_size, const char *const msg)
+// Publishes the final stats, also printing them in debug mode.
+static void report_stats(bool debug)
 {
-	Buffer data;
+	if(!stats_enabled) {
+		return;
+	}
+	stats_publish();
+	if(debug) {
+		stats_dump(stderr);
+	}
+}
 
-	// Ensures the 2 CRC bytes in caption data_group is
-	// not split by the TS packetizer.
-	uint8_t padding = 0;
-	for(;;) {
-		uint8_t *buf = buffer_init(&data, msg_size + padding);
-		memcpy(buf, msg, msg_size);
-		memset(buf + msg_size, 0, padding);
+static int run_server(ServerStream *streams, size_t nstreams, bool debug)
+{
+	fprintf(stderr, "Serving %zu caption streams.\n", nstreams);
 
-		subtitle_boilerplate(&data);
+	int ret = server_run(streams, nstreams, debug);
 
-		if((buffer_get_size(&data) % 184) != 1) {
-			break;
+	for(size_t i = 0; i < nstreams; ++i) {
+		caption_stream_destroy(&streams[i].cs);
+		if(streams[i].in_fd != STDIN_FILENO) {
+			close(streams[i].in_fd);
+		}
+		if(streams[i].udp) {
+			if(close_udp(streams[i].udp, debug) < 0) {
+				ret = -1;
+			}
+			continue;
 		}
 
-		buffer_destroy(&data);
-		++padding;
-	}
-
-	// Also according ARIB TR-B14, Fascicle 2, Section 4.2.2,
-	// minimum interval between PES packets is 100 ms, 
-	// so if last time a PES packet was sent is less than
-	// 100 ms, sleep through the time difference.
-	static double last_time = 0.0;
-	{
-		double diff = time_now() - last_time;
-		if(diff < 0.100) {
-			sleep_for(0.100 - diff);
+		OutputQueue *q = streams[i].queue;
+		output_queue_close(q);
+		OutputStats stats;
+		output_queue_stats(q, &stats);
+		if(debug) {
+			fprintf(stderr, "Stream %zu: ", i);
+			output_stats_print(&stats, stderr);
+		} else if(stats.dropped) {
+			fprintf(stderr, "Stream %zu: %llu packets dropped after "
+				"a write error\n", i, (unsigned long long)stats.dropped);
+		}
+		if(stats.dropped) {
+			ret = -1;
+		}
+		free(q);
+		if(streams[i].out != stdout) {
+			fclose(streams[i].out);
 		}
 	}
-	buffer_write(&data, out);
-
-	last_time = time_now();
+	free(streams);
 
-	buffer_destroy(&data);
+	report_stats(debug);
+	return ret;
 }
 
-static size_t getline(char *buf, size_t size, FILE *f)
+// Encodes every input to a file of the same name in outdir, with the
+// extension of the output format.
+static int run_batch_files(const CaptionConfig *config, const char *outdir,
+	char **inputs, size_t ninputs, unsigned nthreads, bool debug)
 {
-	size_t count = 0;
-	while(count < size) {
-		const int c = getc(f);
-		if(c == EOF) {
-			break;
-		}
+	BatchJob *jobs = calloc(ninputs, sizeof *jobs);
+	const char *ext = config->ts_output ? ".ts" : ".pes";
+	for(size_t i = 0; i < ninputs; ++i) {
+		const char *name = strrchr(inputs[i], '/');
+		name = name ? name + 1 : inputs[i];
+		const char *dot = strrchr(name, '.');
+		const int len = dot && dot != name ? dot - name : (int)strlen(name);
+
+		char *out = malloc(strlen(outdir) + len + strlen(ext) + 2);
+		sprintf(out, "%s/%.*s%s", outdir, len, name, ext);
+		jobs[i].in = inputs[i];
+		jobs[i].out = out;
+	}
 
-		buf[count++] = c;
-		if(c == '\n') {
-			break;
-		}
+	const double start = time_now();
+	const int ret = batch_run_all(config, jobs, ninputs, nthreads);
+	if(debug) {
+		fprintf(stderr, "Encoded %zu files in %.3f s on %u threads.\n",
+			ninputs, time_now() - start, nthreads);
 	}
-	buf[count] = 0;
-	return count;
-}
+	report_stats(debug);
 
-static void spawn_caption_writer()
-{
-	pthread_t cwriter;
-	pthread_create(&cwriter, NULL, caption_writer_thread, stdout);
-	pthread_detach(cwriter);
-	sleep_for(0.5);
+	for(size_t i = 0; i < ninputs; ++i) {
+		free((char *)jobs[i].out);
+	}
+	free(jobs);
+	return ret;
 }
 
 int main(int argc, char *argv[])
 {
-	extern SegType seg_type;
 	uint8_t debug = 0;
-	int lines = 2;
+	CaptionConfig config = CAPTION_CONFIG_DEFAULT;
+	int jobs = sysconf(_SC_NPROCESSORS_ONLN);
+	OutputBackend backend = OUTPUT_WRITEV;
+	const char *send_url = NULL;
+	int ttl = -1;
+	unsigned ts_per_datagram = UDP_OUTPUT_TS_PER_DATAGRAM;
+
+	// Each --stream takes the options given before it.
+	ServerStream *streams = NULL;
+	size_t nstreams = 0;
+
+	stats_catch_signal();
+
 	for(int i = 1; i < argc; ++i) {
 		if(!strcmp(argv[i], "--one-seg")) {
-			seg_type = ONE_SEG;
+			config.seg_type = ONE_SEG;
 		} else if(!strcmp(argv[i], "-d") || !strcmp(argv[i], "--debug")) {
 			debug = 1;
+			if(!stats_enabled) {
+				stats_enable(NULL);
+			}
 		} else if(!strcmp(argv[i], "--sdp-x") || !strcmp(argv[i], "--sdp-y")) {
 			if (argc < i+2) {
 				fprintf(stderr, "Missing SDP parameter for '%s'\n", argv[i]);
@@ -230,80 +201,230 @@ int main(int argc, char *argv[])
 				fprintf(stderr, "Invalid value for '%s': %d\n", argv[i], sdp);
 				return -1;
 			}
-			if(!strcmp(argv[i], "--sdp-x")) sdp_x = sdp;
-			else sdp_y = sdp;
+			if(!strcmp(argv[i], "--sdp-x")) config.sdp_x = sdp;
+			else config.sdp_y = sdp;
 		} else if(!strcmp(argv[i], "--lines")) {
 			if (argc < i+2) {
 				fprintf(stderr, "Missing number of lines\n");
 				return -1;
 			}
-			lines = atoi(argv[i+1]);
+			config.lines = atoi(argv[i+1]);
+			if (config.lines < 1 || config.lines > CAPTION_MAX_LINES) {
+				fprintf(stderr, "Invalid number of lines: %d\n", config.lines);
+				return -1;
+			}
+		} else if(!strcmp(argv[i], "--ts")) {
+			config.ts_output = true;
+		} else if(!strcmp(argv[i], "--pid")) {
+			if (argc < i+2) {
+				fprintf(stderr, "Missing PID\n");
+				return -1;
+			}
+			long pid = strtol(argv[i+1], NULL, 0);
+			if (pid < 0x10 || pid > 0x1ffe) {
+				fprintf(stderr, "Invalid PID: %ld\n", pid);
+				return -1;
+			}
+			config.pid = pid;
+		} else if(!strcmp(argv[i], "--send")) {
+			if (argc < i+2) {
+				fprintf(stderr, "Missing destination for '--send'\n");
+				return -1;
+			}
+			send_url = argv[i+1];
+		} else if(!strcmp(argv[i], "--ttl")) {
+			if (argc < i+2) {
+				fprintf(stderr, "Missing TTL\n");
+				return -1;
+			}
+			ttl = atoi(argv[i+1]);
+			if (ttl < 0 || ttl > 255) {
+				fprintf(stderr, "Invalid TTL: %d\n", ttl);
+				return -1;
+			}
+		} else if(!strcmp(argv[i], "--ts-per-datagram")) {
+			if (argc < i+2) {
+				fprintf(stderr, "Missing number of TS packets\n");
+				return -1;
+			}
+			const int n = atoi(argv[i+1]);
+			if (n < 1 || n > UDP_OUTPUT_TS_PER_DATAGRAM) {
+				fprintf(stderr, "Invalid TS packets per datagram: %d\n", n);
+				return -1;
+			}
+			ts_per_datagram = n;
+		} else if(!strcmp(argv[i], "--stats")) {
+			if (argc < i+2) {
+				fprintf(stderr, "Missing stats file\n");
+				return -1;
+			}
+			stats_enable(argv[i+1]);
+		} else if(!strcmp(argv[i], "--clock")) {
+			if (argc < i+2) {
+				fprintf(stderr, "Missing clock\n");
+				return -1;
+			}
+			if(!strcmp(argv[i+1], "real")) {
+				clock_select(CLOCK_MODE_REAL, 1.0);
+			} else if(!strcmp(argv[i+1], "virtual")) {
+				clock_select(CLOCK_MODE_VIRTUAL, 1.0);
+			} else {
+				const double scale = atof(argv[i+1]);
+				if (scale <= 0.0) {
+					fprintf(stderr, "Invalid clock: '%s'\n", argv[i+1]);
+					return -1;
+				}
+				clock_select(CLOCK_MODE_SCALED, scale);
+			}
+		} else if(!strcmp(argv[i], "--io-uring")) {
+			backend = OUTPUT_URING;
+		} else if(!strcmp(argv[i], "--timecodes")) {
+			config.pts_source = PTS_TIMECODE;
+		} else if(!strcmp(argv[i], "--pcr-ref")) {
+			if (argc < i+2) {
+				fprintf(stderr, "Missing PCR reference\n");
+				return -1;
+			}
+			if(pts_read_pcr(argv[i+1], &config.pts_origin) < 0) {
+				return -1;
+			}
+		} else if(!strcmp(argv[i], "--batch")) {
+			if (argc < i+3) {
+				fprintf(stderr, "Missing input and output for '--batch'\n");
+				return -1;
+			}
+			FILE *out = open_output(argv[i+2]);
+			if(!out) {
+				fprintf(stderr, "Can't open caption output '%s'\n", argv[i+2]);
+				return -1;
+			}
+			const int ret = batch_run(&config, argv[i+1], out);
+			arena_free(arena_thread());
+			if(out != stdout) {
+				fclose(out);
+			}
+			report_stats(debug);
+			return ret;
+		} else if(!strcmp(argv[i], "--jobs")) {
+			if (argc < i+2) {
+				fprintf(stderr, "Missing number of jobs\n");
+				return -1;
+			}
+			jobs = atoi(argv[i+1]);
+			if (jobs < 1) {
+				fprintf(stderr, "Invalid number of jobs: %d\n", jobs);
+				return -1;
+			}
+		} else if(!strcmp(argv[i], "--batch-files")) {
+			if (argc < i+3) {
+				fprintf(stderr, "Missing output directory and inputs for '--batch-files'\n");
+				return -1;
+			}
+			return run_batch_files(&config, argv[i+1], &argv[i+2],
+				argc - i - 2, jobs, debug);
+		} else if(!strcmp(argv[i], "--stream")) {
+			if (argc < i+3) {
+				fprintf(stderr, "Missing input and output for '--stream'\n");
+				return -1;
+			}
+			streams = realloc(streams, (nstreams + 1) * sizeof *streams);
+			ServerStream *s = &streams[nstreams];
+			memset(s, 0, sizeof *s);
+
+			s->in_fd = open_input(argv[i+1]);
+			if(s->in_fd < 0) {
+				fprintf(stderr, "Can't open caption input '%s'\n", argv[i+1]);
+				return -1;
+			}
+			bool failed;
+			CaptionConfig stream_config = config;
+			s->udp = open_udp(argv[i+2], ttl, ts_per_datagram, &failed);
+			if(failed) {
+				return -1;
+			} else if(s->udp) {
+				stream_config.ts_output = true;
+			} else if(!(s->out = open_output(argv[i+2]))) {
+				fprintf(stderr, "Can't open caption output '%s'\n", argv[i+2]);
+				return -1;
+			} else {
+				// Written from a thread of its own, so a slow
+				// output never holds up the other streams.
+				s->queue = malloc(sizeof *s->queue);
+				if(!s->queue
+					|| output_queue_start(s->queue, fileno(s->out), backend) < 0)
+				{
+					return -1;
+				}
+			}
+			caption_stream_init(&s->cs, &stream_config);
+			++nstreams;
+			i += 2;
 		} else if(!strcmp(argv[i], "--help") || !strcmp(argv[i], "-h")) {
-				fprintf(stderr, "Usage: %s [--one-seg] [--debug/-d] [--sdp-x <sdp_x>] [--sdp-y <sdp_y>] [--lines <lines>]\n", argv[0]);
+				fprintf(stderr, "Usage: %s [--one-seg] [--debug/-d] [--sdp-x <sdp_x>] [--sdp-y <sdp_y>] [--lines <lines>] [--ts [--pid <pid>]] [--io-uring] [--stats <file>] [--clock real|virtual|<speed>] [--send udp://<host>:<port>|rtp://<host>:<port>] [--ttl <ttl>] [--ts-per-datagram <n>] [--timecodes] [--pcr-ref <ts_file>] [--batch <subtitles> <output>] [--jobs <n>] [--batch-files <outdir> <subtitles>...] [--stream <input> <output|udp://...|rtp://...> [options] --stream ...]\n", argv[0]);
 				return 0;
 		}
 	}
 
-	fprintf(stderr, "Generating %s-seg PES.\n",
-		seg_type == ONE_SEG ? "one" : "full");
+	if(nstreams) {
+		if(debug) {
+			fputs("Debug mode.\n", stderr);
+		}
+		return run_server(streams, nstreams, debug);
+	}
+
+	static ServerStream stream;
+	if(send_url) {
+		bool failed;
+		stream.udp = open_udp(send_url, ttl, ts_per_datagram, &failed);
+		if(!stream.udp) {
+			if(!failed) {
+				fprintf(stderr, "Not a UDP or RTP destination: '%s'\n",
+					send_url);
+			}
+			return -1;
+		}
+		config.ts_output = true;
+	}
+
+	fprintf(stderr, "Generating %s-seg %s.\n",
+		config.seg_type == ONE_SEG ? "one" : "full",
+		config.ts_output ? "TS" : "PES");
 
 	if(debug) {
 		fputs("Debug mode.\n", stderr);
 	}
 
-	spawn_caption_writer();
-
-	iconv_t cd = iconv_open("l1", "utf8");
+	stream.in_fd = STDIN_FILENO;
+	caption_stream_init(&stream.cs, &config);
+	if(stream.udp) {
+		server_run(&stream, 1, debug);
+		caption_stream_destroy(&stream.cs);
+		close_udp(stream.udp, debug);
+		report_stats(debug);
+		return 1;
+	}
 
-	for(;;) {
-		char orig[lines][4096];
+	// stdin to stdout is served like any other stream, through
+	// the output queue so the event loop never waits on stdout.
+	stream.out = stdout;
+	stream.queue = &output;
 
-		memset(orig, 0, lines*4096*sizeof(char));
+	if(output_queue_start(&output, STDOUT_FILENO, backend) < 0) {
+		return -1;
+	}
 
-		char msg[4096];
-		uint16_t count = 0;
-		uint8_t line_count = 0;
-		while(line_count < lines)
-		{
-			uint16_t ncount = count;
-			if (seg_type == FULL_SEG){
-			msg[ncount++] = 0x1c;
-			msg[ncount++] = 0x4d + line_count;
-			msg[ncount++] = 0x40;
-			}else{
-			msg[ncount++] = 0x0d;
-			}
-			size_t n;
-			{
-				size_t remsize = 4095 - ncount;
-				char *buf = orig[line_count];
-				size_t bn = getline(buf, remsize, stdin);
-				if(bn == 0) {
-					return 1;
-				}
+	server_run(&stream, 1, debug);
+	caption_stream_destroy(&stream.cs);
 
-				char *in = buf;
-				char *out = &msg[ncount];
-				iconv(cd, &in, &bn, &out, &remsize);
-				n = out - &msg[ncount];
-			}
-			if(msg[ncount] == '\n') {
-				if(line_count == 0) {
-					continue;
-				} else {
-					break;
-				}
-			}
-			count = ncount + n;
-			++line_count;
-		}
-		if(debug) {
-			char sub[4096];
-			for (int i = 0; i < lines; ++i) {
-				strcat(sub, orig[i]);
-			}
-			fprintf(stderr, "Sending subtitle:\n%s\n", sub);
-		}
-		write_full_subtitle(stdout, count, msg);
+	output_queue_close(&output);
+	OutputStats stats;
+	output_queue_stats(&output, &stats);
+	if(debug) {
+		output_stats_print(&stats, stderr);
+	} else if(stats.dropped) {
+		fprintf(stderr, "%llu packets dropped after a write error\n",
+			(unsigned long long)stats.dropped);
 	}
+	report_stats(debug);
+	return 1;
 }
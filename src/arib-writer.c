@@ -0,0 +1,146 @@
+#include <assert.h>
+#include <errno.h>
+#include <stdlib.h>
+
+#include "caption.h"
+
+#include "arib-writer.h"
+
+static_assert(ARIB_FULL_SEG == (int)FULL_SEG && ARIB_ONE_SEG == (int)ONE_SEG,
+	"segment types");
+static_assert(ARIB_PTS_WALL_CLOCK == (int)PTS_WALL_CLOCK
+	&& ARIB_PTS_TIMECODE == (int)PTS_TIMECODE && ARIB_PTS_CUE == (int)PTS_CUE,
+	"PTS sources");
+static_assert(ARIB_MANAGEMENT_INTERVAL == CAPTION_MANAGEMENT_INTERVAL,
+	"management interval");
+static_assert(ARIB_MAX_LINES == CAPTION_MAX_LINES, "lines per caption");
+
+// Most ranges of a packet handed to the sink at once.
+#define MAX_IOV 64
+
+struct AribWriter
+{
+	CaptionStream cs;
+	Arena arena;
+	AribSink sink;
+	void *par;
+};
+
+// The limits arib-write checks its command line against, as the
+// encoder asserts them.
+static bool config_valid(const AribWriterConfig *config)
+{
+	if(config->seg_type != ARIB_FULL_SEG && config->seg_type != ARIB_ONE_SEG) {
+		return false;
+	}
+	if(config->pts_source != ARIB_PTS_WALL_CLOCK
+		&& config->pts_source != ARIB_PTS_TIMECODE
+		&& config->pts_source != ARIB_PTS_CUE)
+	{
+		return false;
+	}
+	if(config->sdp_x < 0 || config->sdp_x > 999
+		|| config->sdp_y < 0 || config->sdp_y > 999)
+	{
+		return false;
+	}
+	if(config->lines < 1 || config->lines > ARIB_MAX_LINES) {
+		return false;
+	}
+	return !config->ts_output || (config->pid >= 0x10 && config->pid <= 0x1ffe);
+}
+
+AribWriter *arib_writer_new(const AribWriterConfig *config,
+	AribSink sink, void *par)
+{
+	if(!sink || !config_valid(config)) {
+		errno = EINVAL;
+		return NULL;
+	}
+
+	AribWriter *w = calloc(1, sizeof *w);
+	if(!w) {
+		return NULL;
+	}
+
+	CaptionConfig c = CAPTION_CONFIG_DEFAULT;
+	c.seg_type = (SegType)config->seg_type;
+	c.sdp_x = config->sdp_x;
+	c.sdp_y = config->sdp_y;
+	c.lines = config->lines;
+	c.ts_output = config->ts_output;
+	c.pid = config->pid;
+	c.pts_source = (PTSSource)config->pts_source;
+	c.pts_origin = config->pts_origin;
+	caption_stream_init(&w->cs, &c);
+	w->sink = sink;
+	w->par = par;
+	return w;
+}
+
+void arib_writer_free(AribWriter *w)
+{
+	if(!w) {
+		return;
+	}
+	caption_stream_destroy(&w->cs);
+	arena_free(&w->arena);
+	free(w);
+}
+
+// Hands every packet in pes to the sink, and frees it all.
+static int send_packets(AribWriter *w, Buffer *pes)
+{
+	int ret = 0;
+	while(buffer_get_size(pes)) {
+		Buffer packet;
+		caption_next_packet(&w->cs, &w->arena, pes, &packet);
+
+		struct iovec iov[MAX_IOV];
+		const int n = buffer_iovec(&packet, iov, MAX_IOV, 0);
+		if(ret == 0 && w->sink(w->par, iov, n) < 0) {
+			ret = -1;
+		}
+		buffer_destroy(&packet);
+	}
+	buffer_destroy(pes);
+	arena_reset(&w->arena);
+	return ret;
+}
+
+int arib_writer_push_line(AribWriter *w, const char *line, size_t size)
+{
+	Buffer pes;
+	if(!caption_push_line(&w->cs, &w->arena, line, size, &pes)) {
+		return 0;
+	}
+	return send_packets(w, &pes);
+}
+
+int arib_writer_flush(AribWriter *w)
+{
+	Buffer pes;
+	if(!caption_flush(&w->cs, &w->arena, &pes)) {
+		return 0;
+	}
+	return send_packets(w, &pes);
+}
+
+int arib_writer_clear(AribWriter *w)
+{
+	Buffer pes;
+	caption_clear(&w->cs, &w->arena, &pes);
+	return send_packets(w, &pes);
+}
+
+int arib_writer_management(AribWriter *w)
+{
+	Buffer pes;
+	caption_management(&w->cs, &w->arena, &pes);
+	return send_packets(w, &pes);
+}
+
+void arib_writer_set_time(AribWriter *w, const uint64_t ms)
+{
+	caption_set_time(&w->cs, ms);
+}
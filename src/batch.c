@@ -0,0 +1,531 @@
+#define _GNU_SOURCE
+#include <assert.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "line-reader.h"
+#include "stats.h"
+
+#include "batch.h"
+
+#define MANAGEMENT_INTERVAL_MS \
+	((uint64_t)(CAPTION_MANAGEMENT_INTERVAL * 1000))
+#define PES_INTERVAL_MS ((uint64_t)(PES_MIN_INTERVAL * 1000))
+
+struct Batch
+{
+	CaptionStream cs;
+	// Arena of the thread, kept warm from one file to the next.
+	Arena *arena;
+	FILE *out;
+
+	// Packets of the current cue, written all at once.
+	Buffer pending;
+
+	uint64_t next_management;
+	// PTS of the last PES packet, in ms, once there is one. Packets
+	// are spaced as the server would send them live.
+	bool sent;
+	uint64_t last_ms;
+	// End of the cue on screen, if any.
+	bool shown;
+	uint64_t clear_at;
+
+	// Writing the output failed.
+	bool failed;
+
+	// Cue being read.
+	bool in_block;
+	bool skip_block;
+	bool timed;
+	uint64_t start, end;
+};
+typedef struct Batch Batch;
+
+// Moves the PES packets in pes, encoded for time ms, to the pending
+// output. Each takes the first slot from ms on that is PES_MIN_INTERVAL
+// after the one before, with its PTS patched if it's later.
+static void emit(Batch *b, Buffer *pes, const uint64_t ms)
+{
+	while(buffer_get_size(pes)) {
+		uint64_t slot = ms;
+		if(b->sent && slot < b->last_ms + PES_INTERVAL_MS) {
+			slot = b->last_ms + PES_INTERVAL_MS;
+		}
+		if(slot != ms) {
+			// The header of every packet is prepended in one piece.
+			size_t size;
+			uint8_t *header = buffer_head(pes, &size);
+			assert(size >= PES_PTS_OFFSET + 5);
+			caption_set_time(&b->cs, slot);
+			PES_update_PTS(&b->cs.dg.pes, header);
+		}
+		b->sent = true;
+		b->last_ms = slot;
+
+		Buffer wire;
+		caption_next_packet(&b->cs, b->arena, pes, &wire);
+		buffer_concat(&b->pending, &wire);
+	}
+	buffer_destroy(pes);
+}
+
+static void management_until(Batch *b, const uint64_t ms)
+{
+	for(; b->next_management <= ms;
+		b->next_management += MANAGEMENT_INTERVAL_MS)
+	{
+		caption_set_time(&b->cs, b->next_management);
+
+		// The packet is cached in the stream and patched by the
+		// next call, so it's copied before the next one is made.
+		Buffer data;
+		caption_management(&b->cs, b->arena, &data);
+		const size_t size = buffer_get_size(&data);
+
+		Buffer pes;
+		BufferReader r;
+		buffer_reader_init(&r, &data);
+		buffer_read(&r, buffer_init_reserved(&pes, b->arena, size, 0, 0),
+			size);
+		buffer_destroy(&data);
+
+		emit(b, &pes, b->next_management);
+	}
+}
+
+static void clear_until(Batch *b, const uint64_t ms)
+{
+	if(b->shown && b->clear_at <= ms) {
+		management_until(b, b->clear_at);
+		caption_set_time(&b->cs, b->clear_at);
+
+		Buffer pes;
+		caption_clear(&b->cs, b->arena, &pes);
+		emit(b, &pes, b->clear_at);
+		b->shown = false;
+	}
+}
+
+static void write_pending(Batch *b)
+{
+	const uint64_t start = stats_start();
+	stats_count(STATS_BYTES, buffer_get_size(&b->pending));
+	if(!b->failed && buffer_write(&b->pending, b->out) < 0) {
+		b->failed = true;
+	}
+	stats_stop(STATS_WRITE, start);
+	buffer_destroy(&b->pending);
+	arena_reset(b->arena);
+	b->pending.arena = b->arena;
+}
+
+// Ends the block of lines being read, showing its cue if it has one.
+static void end_block(Batch *b)
+{
+	if(b->timed) {
+		// A cue starting before the last one ends replaces it,
+		// as every caption starts by clearing the screen.
+		clear_until(b, b->start > 0 ? b->start - 1 : 0);
+		management_until(b, b->start);
+		caption_set_time(&b->cs, b->start);
+
+		Buffer pes;
+		if(caption_flush(&b->cs, b->arena, &pes)) {
+			emit(b, &pes, b->start);
+			b->shown = true;
+			b->clear_at = b->end;
+		}
+		write_pending(b);
+	}
+
+	b->in_block = false;
+	b->skip_block = false;
+	b->timed = false;
+}
+
+// Parses a cue time, "[HH:]MM:SS.mmm" in WebVTT, "HH:MM:SS,mmm" in
+// SRT. Returns the end of it, or NULL.
+static const char *parse_time(const char *p, const char *end, uint64_t *ms)
+{
+	uint64_t fields[3];
+	int nfields = 0;
+	for(;;) {
+		const char *digits = p;
+		uint64_t v = 0;
+		while(p < end && *p >= '0' && *p <= '9') {
+			v = v * 10 + (*p++ - '0');
+		}
+		if(p == digits || nfields == 3) {
+			return NULL;
+		}
+		fields[nfields++] = v;
+		if(p == end || *p != ':') {
+			break;
+		}
+		++p;
+	}
+	if(nfields < 2) {
+		return NULL;
+	}
+
+	uint64_t t = 0;
+	for(int i = 0; i < nfields; ++i) {
+		t = t * 60 + fields[i];
+	}
+	t *= 1000;
+
+	if(p < end && (*p == '.' || *p == ',')) {
+		++p;
+		uint64_t scale = 100;
+		for(; p < end && *p >= '0' && *p <= '9'; ++p) {
+			t += (*p - '0') * scale;
+			scale /= 10;
+		}
+	}
+
+	*ms = t;
+	return p;
+}
+
+// Parses "start --> end", followed by WebVTT cue settings, if any.
+static bool parse_timing(Batch *b, const char *p, const char *end)
+{
+	while(p < end && (*p == ' ' || *p == '\t')) {
+		++p;
+	}
+	if(!(p = parse_time(p, end, &b->start))) {
+		return false;
+	}
+	while(p < end && (*p == ' ' || *p == '\t')) {
+		++p;
+	}
+	if(end - p < 3 || memcmp(p, "-->", 3)) {
+		return false;
+	}
+	p += 3;
+	while(p < end && (*p == ' ' || *p == '\t')) {
+		++p;
+	}
+	return parse_time(p, end, &b->end) != NULL;
+}
+
+// Drops the markup of a line of cue text, tags like "<i>" and the
+// entities WebVTT escapes '&', '<' and '>' with.
+static size_t strip_markup(const char *in, const size_t size, char *out)
+{
+	static const struct {
+		const char *name;
+		char c;
+	} entities[] = {{"&amp;", '&'}, {"&lt;", '<'}, {"&gt;", '>'},
+		{"&nbsp;", ' '}};
+
+	size_t o = 0;
+	for(size_t i = 0; i < size; ++i) {
+		if(in[i] == '<') {
+			const char *close = memchr(in + i, '>', size - i);
+			if(close) {
+				i = close - in;
+				continue;
+			}
+		} else if(in[i] == '&') {
+			size_t e = 0;
+			for(; e < sizeof entities / sizeof *entities; ++e) {
+				const size_t len = strlen(entities[e].name);
+				if(size - i >= len && !memcmp(in + i, entities[e].name, len)) {
+					out[o++] = entities[e].c;
+					i += len - 1;
+					break;
+				}
+			}
+			if(e < sizeof entities / sizeof *entities) {
+				continue;
+			}
+		}
+		out[o++] = in[i];
+	}
+	return o;
+}
+
+static bool starts_block(const char *line, const size_t size,
+	const char *word)
+{
+	const size_t len = strlen(word);
+	return size >= len && !memcmp(line, word, len)
+		&& (size == len || line[len] == ' ' || line[len] == '\t');
+}
+
+static void batch_line(Batch *b, const char *line, size_t size)
+{
+	while(size && (line[size - 1] == '\n' || line[size - 1] == '\r')) {
+		--size;
+	}
+	if(!size) {
+		if(b->in_block) {
+			end_block(b);
+		}
+		return;
+	}
+
+	if(!b->in_block) {
+		b->in_block = true;
+		// The WebVTT header, and blocks that aren't cues.
+		b->skip_block = starts_block(line, size, "WEBVTT")
+			|| starts_block(line, size, "NOTE")
+			|| starts_block(line, size, "STYLE")
+			|| starts_block(line, size, "REGION");
+	}
+	if(b->skip_block) {
+		return;
+	}
+
+	if(!b->timed) {
+		// Lines before the timing are the SRT counter, or the
+		// WebVTT cue identifier.
+		if(memmem(line, size, "-->", 3)) {
+			b->timed = parse_timing(b, line, line + size);
+			if(!b->timed) {
+				fprintf(stderr, "Skipping cue with bad timing: %.*s\n",
+					(int)size, line);
+				b->skip_block = true;
+			}
+		}
+		return;
+	}
+
+	char text[CAPTION_MAX_TEXT + 1];
+	size = strip_markup(line, size, text);
+	if(size) {
+		text[size++] = '\n';
+		// Cues set their own number of lines, so a caption is only
+		// completed early by a cue too long for it.
+		Buffer pes;
+		if(caption_push_line(&b->cs, b->arena, text, size, &pes)) {
+			fprintf(stderr, "Skipping cue too long for a caption, "
+				"at %llu ms\n", (unsigned long long)b->start);
+			buffer_destroy(&pes);
+			b->skip_block = true;
+		}
+	}
+}
+
+int batch_run(const CaptionConfig *config, const char *path, FILE *out)
+{
+	const int fd = open(path, O_RDONLY);
+	if(fd < 0) {
+		perror("Can't open subtitles");
+		return -1;
+	}
+
+	// Too big for the stack, with the buffers of its CaptionStream.
+	Batch *b = calloc(1, sizeof *b);
+
+	CaptionConfig c = *config;
+	c.pts_source = PTS_CUE;
+	c.lines = INT_MAX;
+	caption_stream_init(&b->cs, &c);
+	b->out = out;
+	b->arena = arena_thread();
+	b->pending.arena = b->arena;
+
+	LineReader reader;
+	line_reader_init(&reader, fd, CAPTION_MAX_TEXT);
+
+	int ret = 0;
+	bool first = true;
+	while(!reader.eof) {
+		if(line_reader_fill(&reader) < 0 && reader.eof) {
+			perror("Error reading subtitles");
+			ret = -1;
+			break;
+		}
+
+		LineView line;
+		while(line_reader_next(&reader, &line)) {
+			// UTF-8 byte order mark.
+			if(first && line.size >= 3
+				&& !memcmp(line.data, "\xef\xbb\xbf", 3))
+			{
+				line.data += 3;
+				line.size -= 3;
+			}
+			first = false;
+			batch_line(b, line.data, line.size);
+		}
+	}
+
+	if(b->in_block) {
+		end_block(b);
+	}
+	clear_until(b, UINT64_MAX);
+	write_pending(b);
+	if(b->failed) {
+		ret = -1;
+	}
+
+	line_reader_destroy(&reader);
+	caption_stream_destroy(&b->cs);
+	free(b);
+	close(fd);
+	return ret;
+}
+
+// Jobs [begin, end) of a worker, packed as begin << 32 | end so
+// its owner and thieves update it with a single compare-and-swap.
+// The owner takes jobs from the front, thieves the back half.
+struct BatchWorker
+{
+	_Alignas(64) _Atomic uint64_t range;
+	pthread_t thread;
+	struct BatchPool *pool;
+};
+typedef struct BatchWorker BatchWorker;
+
+struct BatchPool
+{
+	const CaptionConfig *config;
+	BatchJob *jobs;
+	BatchWorker *workers;
+	unsigned nworkers;
+};
+typedef struct BatchPool BatchPool;
+
+static uint64_t pack_range(const uint32_t begin, const uint32_t end)
+{
+	return (uint64_t)begin << 32 | end;
+}
+
+static bool take_job(BatchWorker *w, size_t *job)
+{
+	uint64_t r = atomic_load(&w->range);
+	uint32_t begin, end;
+	do {
+		begin = r >> 32;
+		end = r;
+		if(begin == end) {
+			return false;
+		}
+	} while(!atomic_compare_exchange_weak(&w->range, &r,
+		pack_range(begin + 1, end)));
+
+	*job = begin;
+	return true;
+}
+
+// Moves the back half of the jobs of victim to w, whose range is empty.
+static bool steal_jobs(BatchWorker *w, BatchWorker *victim)
+{
+	uint64_t r = atomic_load(&victim->range);
+	uint32_t begin, end, mid;
+	do {
+		begin = r >> 32;
+		end = r;
+		if(begin == end) {
+			return false;
+		}
+		mid = begin + (end - begin) / 2;
+	} while(!atomic_compare_exchange_weak(&victim->range, &r,
+		pack_range(begin, mid)));
+
+	atomic_store(&w->range, pack_range(mid, end));
+	return true;
+}
+
+static void run_job(BatchPool *pool, BatchJob *job)
+{
+	FILE *out = fopen(job->out, "wb");
+	if(!out) {
+		fprintf(stderr, "Can't open caption output '%s'\n", job->out);
+		job->ret = -1;
+		return;
+	}
+	job->ret = batch_run(pool->config, job->in, out);
+	if(fclose(out) != 0) {
+		perror("Failed to write output");
+		job->ret = -1;
+	}
+}
+
+static void *worker_main(void *par)
+{
+	BatchWorker *w = par;
+	BatchPool *pool = w->pool;
+	const unsigned self = w - pool->workers;
+
+	for(;;) {
+		size_t job;
+		while(take_job(w, &job)) {
+			run_job(pool, &pool->jobs[job]);
+		}
+
+		// Once no worker has jobs left to steal, all have been
+		// taken: the ones in flight between two workers included.
+		unsigned i = 1;
+		for(; i < pool->nworkers; ++i) {
+			if(steal_jobs(w, &pool->workers[(self + i) % pool->nworkers])) {
+				break;
+			}
+		}
+		if(i == pool->nworkers) {
+			arena_free(arena_thread());
+			return NULL;
+		}
+	}
+}
+
+int batch_run_all(const CaptionConfig *config, BatchJob *jobs,
+	const size_t njobs, unsigned nthreads)
+{
+	assert(njobs <= UINT32_MAX);
+	if(nthreads > njobs) {
+		nthreads = njobs;
+	}
+	if(nthreads == 0) {
+		nthreads = 1;
+	}
+
+	BatchPool pool = {
+		.config = config,
+		.jobs = jobs,
+		.nworkers = nthreads,
+	};
+	pool.workers = aligned_alloc(_Alignof(BatchWorker),
+		nthreads * sizeof *pool.workers);
+
+	// Contiguous shares to start with, rebalanced by stealing.
+	for(unsigned i = 0; i < nthreads; ++i) {
+		BatchWorker *w = &pool.workers[i];
+		w->pool = &pool;
+		atomic_init(&w->range, pack_range(njobs * i / nthreads,
+			njobs * (i + 1) / nthreads));
+	}
+
+	// The calling thread is worker 0.
+	unsigned started = 1;
+	for(; started < nthreads; ++started) {
+		BatchWorker *w = &pool.workers[started];
+		if(pthread_create(&w->thread, NULL, worker_main, w) != 0) {
+			perror("Failed to start batch worker");
+			break;
+		}
+	}
+	worker_main(&pool.workers[0]);
+	for(unsigned i = 1; i < started; ++i) {
+		pthread_join(pool.workers[i].thread, NULL);
+	}
+	free(pool.workers);
+
+	int ret = 0;
+	for(size_t i = 0; i < njobs; ++i) {
+		if(jobs[i].ret < 0) {
+			ret = -1;
+		}
+	}
+	return ret;
+}
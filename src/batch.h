@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stdio.h>
+
+#include "caption.h"
+
+//! Encodes a whole SRT or WebVTT file into out, as fast as it can be
+//! written, with PTS taken from cue times, counted from the
+//! pts_origin of config. Each cue is shown until its end time, and
+//! management data is interleaved at its scheduled PTS. Packets are
+//! built on arena_thread(), which the caller frees when done.
+//! Returns 0, or -1 on error.
+int batch_run(const CaptionConfig *config, const char *path, FILE *out);
+
+// A file for batch_run_all() to encode.
+struct BatchJob
+{
+	const char *in;
+	const char *out;
+	// Set by batch_run_all(): 0, or -1 on error.
+	int ret;
+};
+typedef struct BatchJob BatchJob;
+
+//! Runs batch_run() for every job, on up to nthreads threads, each file
+//! encoded exactly as a serial run would. Returns 0, or -1 if any job
+//! failed.
+int batch_run_all(const CaptionConfig *config, BatchJob *jobs, size_t njobs,
+	unsigned nthreads);
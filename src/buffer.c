@@ -3,47 +3,161 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <stddef.h>
+#include <errno.h>
+#include <poll.h>
 #include <sys/uio.h>
 
 #include "buffer.h"
+#include "crc.h"
+#include "stats.h"
 
 struct BufferLink
 {
 	struct BufferLink *next;
+	uint8_t *data;
 	size_t size;
-	uint8_t data[];
+	// Unused bytes right before and after data.
+	size_t headroom;
+	size_t tailroom;
+	// Allocated with malloc, rather than taken from an arena.
+	bool heap;
+	// Link whose storage holds data: itself, or the link this is a
+	// view of. The owner is released when the last view is gone.
+	struct BufferLink *owner;
+	unsigned refs;
+	uint8_t storage[];
 };
 typedef struct BufferLink BLink;
 
-static BLink *alloc_blink(const size_t size)
+// Extra room given to links created by a prepend on an arena Buffer,
+// so a following prepend of another header fits in place.
+#define ARENA_LINK_HEADROOM 64
+
+// Most links given to a single writev() call.
+#define MAX_IOV 1024
+
+static atomic_size_t allocations;
+
+static _Thread_local Arena thread_arena;
+
+Arena *arena_thread(void)
 {
-	BLink *ret = malloc((sizeof *ret) + size);
-	ret->size = size;
-	ret->next = NULL;
+	return &thread_arena;
+}
+
+static void *arena_alloc(Arena *const arena, size_t size)
+{
+	const size_t align = _Alignof(max_align_t);
+	size = (size + align - 1) & ~(align - 1);
+
+	arena->demand += size;
+	if(arena->used + size > arena->capacity) {
+		return NULL;
+	}
 
+	void *ret = arena->base + arena->used;
+	arena->used += size;
 	return ret;
 }
 
-uint8_t *buffer_init(Buffer *const buf, const size_t size)
+void arena_reset(Arena *const arena)
 {
-	buf->total_size = size;
+	if(arena->demand > arena->capacity) {
+		size_t capacity = arena->capacity ? arena->capacity : 4096;
+		while(capacity < arena->demand) {
+			capacity *= 2;
+		}
 
-	BLink *blink = alloc_blink(size);
+		free(arena->base);
+		arena->base = malloc(capacity);
+		arena->capacity = capacity;
+		++allocations;
+	}
+	arena->used = 0;
+	arena->demand = 0;
+}
 
-	buf->head = blink;
-	buf->last = &blink->next;
+void arena_free(Arena *const arena)
+{
+	free(arena->base);
+	*arena = (Arena){0};
+}
+
+static BLink *alloc_blink(Arena *const arena, const size_t size,
+	const size_t headroom, const size_t tailroom)
+{
+	const size_t bytes = (sizeof (BLink)) + headroom + size + tailroom;
 
+	BLink *ret = arena ? arena_alloc(arena, bytes) : NULL;
+	if(ret) {
+		ret->heap = false;
+	} else {
+		ret = malloc(bytes);
+		ret->heap = true;
+		++allocations;
+	}
+	ret->next = NULL;
+	ret->owner = ret;
+	ret->refs = 1;
+	ret->data = ret->storage + headroom;
+	ret->size = size;
+	ret->headroom = headroom;
+	ret->tailroom = tailroom;
+
+	return ret;
+}
+
+uint8_t *buffer_init_reserved(Buffer *const buf, Arena *const arena,
+	const size_t size, const size_t headroom, const size_t tailroom)
+{
+	BLink *blink = alloc_blink(arena, size, headroom, tailroom);
+
+	buf->total_size = size;
+	buf->head = buf->tail = blink;
 	buf->nchunks = 1;
+	buf->arena = arena;
 
 	return blink->data;
 }
 
+uint8_t *buffer_init(Buffer *const buf, const size_t size)
+{
+	return buffer_init_reserved(buf, NULL, size, 0, 0);
+}
+
+// Link with no storage of its own, referencing the bytes of another.
+static BLink *alloc_view(Arena *const arena, BLink *const of,
+	uint8_t *const data, const size_t size)
+{
+	BLink *ret = alloc_blink(arena, 0, 0, 0);
+	ret->data = data;
+	ret->size = size;
+	ret->owner = of->owner;
+	++ret->owner->refs;
+
+	return ret;
+}
+
+static void release_blink(BLink *const l)
+{
+	BLink *owner = l->owner;
+	if(owner != l && l->heap) {
+		free(l);
+	}
+	if(--owner->refs == 0 && owner->heap) {
+		free(owner);
+	}
+}
+
 void buffer_destroy(Buffer *const buf)
 {
 	BLink *l = buf->head;
 	while(l) {
 		BLink *next = l->next;
-		free(l);
+		release_blink(l);
 		l = next;
 	}
 	memset(buf, 0, sizeof *buf);
@@ -51,11 +165,23 @@ void buffer_destroy(Buffer *const buf)
 
 uint8_t *buffer_append(Buffer *const buf, const size_t size)
 {
-	BLink *l = alloc_blink(size);
-	*buf->last = l;
-	buf->last = &l->next;
-
 	buf->total_size += size;
+
+	BLink *l = buf->tail;
+	if(l && l->tailroom >= size) {
+		uint8_t *ret = l->data + l->size;
+		l->size += size;
+		l->tailroom -= size;
+		return ret;
+	}
+
+	l = alloc_blink(buf->arena, size, 0, 0);
+	if(buf->tail) {
+		buf->tail->next = l;
+	} else {
+		buf->head = l;
+	}
+	buf->tail = l;
 	++buf->nchunks;
 
 	return l->data;
@@ -63,146 +189,225 @@ uint8_t *buffer_append(Buffer *const buf, const size_t size)
 
 uint8_t *buffer_prepend(Buffer *const buf, const size_t size)
 {
-	BLink *l = alloc_blink(size);
+	buf->total_size += size;
+
+	BLink *l = buf->head;
+	if(l && l->headroom >= size) {
+		l->data -= size;
+		l->size += size;
+		l->headroom -= size;
+		return l->data;
+	}
+
+	l = alloc_blink(buf->arena, size,
+		buf->arena ? ARENA_LINK_HEADROOM : 0, 0);
 	l->next = buf->head;
 	buf->head = l;
+	if(!buf->tail) {
+		buf->tail = l;
+	}
+	++buf->nchunks;
+
+	return l->data;
+}
+
+uint8_t *buffer_head(const Buffer *const buf, size_t *const size)
+{
+	const BLink *l = buf->head;
+	if(!l) {
+		*size = 0;
+		return NULL;
+	}
+	*size = l->size;
+	return l->data;
+}
 
+void buffer_prepend_ref(Buffer *const buf, const uint8_t *const data,
+	const size_t size)
+{
 	buf->total_size += size;
+
+	// Never written to: no room around it, and the next prepend
+	// gets a link of its own.
+	BLink *l = alloc_blink(buf->arena, 0, 0, 0);
+	l->data = (uint8_t *)data;
+	l->size = size;
+	l->next = buf->head;
+	buf->head = l;
+	if(!buf->tail) {
+		buf->tail = l;
+	}
 	++buf->nchunks;
+}
 
-	return l->data;
+int buffer_iovec(const Buffer *const buf, struct iovec *const iov,
+	const int max, size_t offset)
+{
+	int n = 0;
+	for(BLink *l = buf->head; l && n < max; l = l->next) {
+		if(offset >= l->size) {
+			offset -= l->size;
+			continue;
+		}
+		iov[n].iov_base = l->data + offset;
+		iov[n].iov_len = l->size - offset;
+		offset = 0;
+		++n;
+	}
+	return n;
 }
 
-void buffer_write(const Buffer *const buf, FILE *out)
+ssize_t buffer_write_fd(const Buffer *const buf, const int fd, size_t offset)
 {
-	struct iovec iov[buf->nchunks];
+	struct iovec iov[MAX_IOV];
 
-	BLink *l = buf->head;
-	size_t i = 0;
-	while(l) {
-		iov[i].iov_base = l->data;
-		iov[i].iov_len = l->size;
-		l = l->next;
-		++i;
+	const int n = buffer_iovec(buf, iov, MAX_IOV, offset);
+	if(!n) {
+		return 0;
 	}
-	writev(fileno(out), iov, buf->nchunks);
+	return writev(fd, iov, n);
+}
+
+int buffer_write(const Buffer *const buf, FILE *out)
+{
+	const int fd = fileno(out);
+
+	size_t done = 0;
+	while(done < buf->total_size) {
+		const ssize_t n = buffer_write_fd(buf, fd, done);
+		if(n < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			if(errno == EAGAIN || errno == EWOULDBLOCK) {
+				// Non-blocking, and full: wait for room.
+				struct pollfd pfd = {.fd = fd, .events = POLLOUT};
+				while(poll(&pfd, 1, -1) < 0 && errno == EINTR)
+					;
+				continue;
+			}
+			perror("Failed to write output");
+			return -1;
+		}
+		done += n;
+	}
+	return 0;
 }
 
 void buffer_chop_head(Buffer *buf, size_t size, Buffer *head)
 {
-	assert(buf->total_size <= size);
+	assert(size <= buf->total_size);
 
 	head->total_size = size;
+	head->nchunks = 0;
+	head->head = head->tail = NULL;
+	head->arena = buf->arena;
 	buf->total_size -= size;
 
-	BLink *l = head->head = buf->head;
-	size_t count = l->size;
-	--buf->nchunks;
-	++head->nchunks;
-	
+	BLink *l = buf->head;
+	BLink *prev = NULL;
+	size_t count = 0;
 	while(count < size) {
-		l = l->next;
+		if(count + l->size > size) {
+			// Split the link: the tail part becomes a view
+			// sharing the same storage, so nothing is copied.
+			const size_t keep = size - count;
+			BLink *nl = alloc_view(buf->arena, l,
+				l->data + keep, l->size - keep);
+			nl->tailroom = l->tailroom;
+			nl->next = l->next;
+
+			l->size = keep;
+			l->tailroom = 0;
+			l->next = nl;
+
+			if(buf->tail == l) {
+				buf->tail = nl;
+			}
+			++buf->nchunks;
+		}
+
 		count += l->size;
+		prev = l;
+		l = l->next;
+
+		--buf->nchunks;
+		++head->nchunks;
 	}
 
-	const size_t diff = count - size;
+	if(prev) {
+		head->head = buf->head;
+		head->tail = prev;
+		prev->next = NULL;
+	}
 
-	if(diff || !buf->total_size) {
-		BLink *nl = alloc_blink(diff);
-		l->size -= diff;
-		memcpy(nl->data, l->data + l->size, diff);
+	buf->head = l;
+	if(!l) {
+		buf->tail = NULL;
+	}
+}
 
-		nl->next = l->next;
-		buf->head = nl;
-		buf->last = &nl->next;
-		++buf->nchunks;
-	} else {
-		assert(l->next);
-		buf->head = l->next;
+void buffer_concat(Buffer *buf, Buffer *tail)
+{
+	if(tail->head) {
+		if(buf->tail) {
+			buf->tail->next = tail->head;
+		} else {
+			buf->head = tail->head;
+		}
+		buf->tail = tail->tail;
 	}
+	buf->nchunks += tail->nchunks;
+	buf->total_size += tail->total_size;
 
-	l->next = NULL;
-	head->last = &l->next;
+	memset(tail, 0, sizeof *tail);
 }
 
-size_t buffer_get_size(Buffer *buf)
+void buffer_reader_init(BufferReader *r, const Buffer *buf)
 {
-	return buf->total_size;
+	r->link = buf->head;
+	r->pos = 0;
 }
 
-uint16_t buffer_CRC16(Buffer *buf)
+size_t buffer_read(BufferReader *r, uint8_t *dst, size_t size)
 {
-	const uint16_t poly = 0x1021;
-
-	//uint16_t crc = (((uint16_t)data[0]) << 8) | data[1];
-	uint16_t crc = 0x0000;
-	unsigned short i, v, xor_flag;
-
-	BLink *l = buf->head;
+	size_t count = 0;
+	while(count < size && r->link) {
+		const BLink *l = r->link;
+		size_t n = l->size - r->pos;
+		if(n > size - count) {
+			n = size - count;
+		}
+		memcpy(dst + count, l->data + r->pos, n);
+		count += n;
+		r->pos += n;
 
-	while(l) {
-		for(size_t c = 0; c < l->size; ++c) 
-		{
-			uint8_t ch = l->data[c];
-
-			/*
-			Align test bit with leftmost bit of the message byte.
-			*/
-			v = 0x80;
-
-			for (i=0; i<8; i++)
-			{
-				if (crc & 0x8000)
-				{
-					xor_flag= 1;
-				}
-				else
-				{
-					xor_flag= 0;
-				}
-				crc = crc << 1;
-
-				if (ch & v)
-				{
-					/*
-					Append next bit of message to end of CRC if it is not zero.
-					The zero bit placed there by the shift above need not be
-					changed if the next bit of the message is zero.
-					*/
-					crc = crc + 1;
-				}
-
-				if (xor_flag)
-				{
-					crc = crc ^ poly;
-				}
-
-				/*
-				Align test bit with next bit of the message byte.
-				*/
-				v = v >> 1;
-			}
+		if(r->pos == l->size) {
+			r->link = l->next;
+			r->pos = 0;
 		}
-		l = l->next;
 	}
+	stats_count(STATS_COPIED_BYTES, count);
+	return count;
+}
 
-	for (i=0; i<16; i++)
-    {
-        if (crc & 0x8000)
-        {
-            xor_flag= 1;
-        }
-        else
-        {
-            xor_flag= 0;
-        }
-        crc = crc << 1;
-
-        if (xor_flag)
-        {
-            crc = crc ^ poly;
-        }
-    }
+size_t buffer_allocations(void)
+{
+	return allocations;
+}
 
+size_t buffer_get_size(Buffer *buf)
+{
+	return buf->total_size;
+}
+
+uint16_t buffer_CRC16(Buffer *buf)
+{
+	const uint64_t start = stats_start();
+	uint16_t crc = 0;
+	for(BLink *l = buf->head; l; l = l->next) {
+		crc = crc16_update(crc, l->data, l->size);
+	}
+	stats_stop(STATS_CRC, start);
 	return crc;
 }
@@ -2,6 +2,33 @@
 
 #include <stdio.h>
 #include <stdint.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+// Bump allocator backing Buffers that are built and thrown away
+// once per caption. Links are never freed individually: the whole
+// arena is released at once by arena_reset(). If a caption needs more
+// than the arena holds, the excess goes to the heap and the arena
+// grows on the next reset, so steady state needs no allocation at all.
+struct Arena
+{
+	uint8_t *base;
+	size_t capacity;
+	size_t used;
+	// Bytes requested since last reset, including heap overflow.
+	size_t demand;
+};
+typedef struct Arena Arena;
+
+//! Arena private to the calling thread. Threads that use it must
+//! arena_free() it before they exit.
+Arena *arena_thread(void);
+
+//! Invalidates every Buffer built on the arena.
+void arena_reset(Arena *arena);
+
+//! Releases the memory of the arena, which is left empty and usable.
+void arena_free(Arena *arena);
 
 // Linked list of arrays to use as buffer.
 struct Buffer
@@ -9,22 +36,73 @@ struct Buffer
 	size_t nchunks;
 	size_t total_size;
 	struct BufferLink *head;
-	struct BufferLink **last;
+	struct BufferLink *tail;
+	// If not NULL, links come from this arena instead of malloc.
+	Arena *arena;
 };
 typedef struct Buffer Buffer;
 
 //! Assumes Buffer is deallocated.
 uint8_t *buffer_init(Buffer *buf, const size_t size);
 
+//! Like buffer_init(), but allocates one contiguous block with room
+//! for headroom bytes of buffer_prepend() and tailroom bytes of
+//! buffer_append(), which then take no further allocation.
+//! If arena is NULL, the block comes from the heap.
+uint8_t *buffer_init_reserved(Buffer *buf, Arena *arena, size_t size,
+	size_t headroom, size_t tailroom);
+
 void buffer_destroy(Buffer *buf);
 
 uint8_t *buffer_append(Buffer *buf, size_t size);
 uint8_t *buffer_prepend(Buffer *buf, size_t size);
 
-void buffer_write(const Buffer *buf, FILE *out);
+//! First bytes of buf, the ones in its first link, to be changed in
+//! place. Sets *size to how many there are, which may be 0. Bytes
+//! added with buffer_prepend_ref() must not be changed.
+uint8_t *buffer_head(const Buffer *buf, size_t *size);
+
+//! Prepends size bytes at data without copying them. They must stay
+//! unchanged until every Buffer referencing them is destroyed.
+void buffer_prepend_ref(Buffer *buf, const uint8_t *data, size_t size);
+
+//! Writes all of buf, retrying short writes, and waiting for room if
+//! out is non-blocking. Returns 0, or -1 on error.
+int buffer_write(const Buffer *buf, FILE *out);
 
+//! Fills up to max entries of iov with the bytes of buf past offset,
+//! one per link. Returns how many were filled.
+int buffer_iovec(const Buffer *buf, struct iovec *iov, int max,
+	size_t offset);
+
+//! Single writev() of the bytes of buf past offset. Returns what
+//! writev() returns, which may be less than asked for.
+ssize_t buffer_write_fd(const Buffer *buf, int fd, size_t offset);
+
+//! Moves the first size bytes of buf into head, which is assumed
+//! deallocated. A link holding bytes of both parts is not copied:
+//! both Buffers reference its storage, released when both are destroyed.
 void buffer_chop_head(Buffer *buf, size_t size, Buffer *head);
 
+//! Moves all the links of tail to the end of buf, leaving tail empty.
+void buffer_concat(Buffer *buf, Buffer *tail);
+
+// Sequential reader over the bytes of a Buffer.
+struct BufferReader
+{
+	const struct BufferLink *link;
+	size_t pos;
+};
+typedef struct BufferReader BufferReader;
+
+void buffer_reader_init(BufferReader *r, const Buffer *buf);
+
+//! Copies up to size bytes to dst, returns how many were copied.
+size_t buffer_read(BufferReader *r, uint8_t *dst, size_t size);
+
 size_t buffer_get_size(Buffer *buf);
 
 uint16_t buffer_CRC16(Buffer *buf);
+
+//! Number of heap allocations done by the buffer module so far.
+size_t buffer_allocations(void);
@@ -0,0 +1,341 @@
+#include <assert.h>
+#include <string.h>
+
+#include "caption.h"
+#include "pts.h"
+#include "stats.h"
+
+// Room reserved around every caption payload for the headers the
+// encoder chain prepends (at most 99 bytes) and the CRC it appends,
+// so building a packet takes no allocation besides the arena.
+#define CAPTION_HEADROOM 128
+#define CAPTION_TAILROOM 2
+
+// Room after the text of a statement: the padding byte and the CRC.
+#define STATEMENT_TAILROOM (1 + CAPTION_TAILROOM)
+
+void caption_stream_init(CaptionStream *cs, const CaptionConfig *config)
+{
+	memset(cs, 0, sizeof *cs);
+	cs->config = *config;
+
+	cs->dg.pes.seg_type = config->seg_type;
+	cs->dg.pes.pts_source = config->pts_source;
+	cs->dg.pes.pts_origin = config->pts_origin;
+	cs->dg.pes.pts = config->pts_origin;
+
+	cs->ts.pid = config->pid;
+}
+
+void caption_stream_destroy(CaptionStream *cs)
+{
+	(void)cs;
+}
+
+// Control codes are defined in both ABNT NBR 15606-1, Tabela 13
+// and ARIB STD-B24, Table 7-14.
+// The semantics are specified in ARIB STD-B24, Table 7-15 and 7-16.
+// Commands started by CSI (control sequence introducer), 0x9b, are
+// defined in ARIB STD-B24, Table 7-17, and end with 0x20 and a final byte.
+
+// FULL_SEG boilerplate, up to the parameters of SDP.
+static const uint8_t full_seg_head[] = {
+	// CS (clear screen)
+	0x0c,
+	// Set Writing Format (SWF)
+	0x9b, '7', 0x20, 0x53,
+	// Set Display Position (SDP), "xxx;yyy" follow
+	0x9b,
+};
+
+// FULL_SEG boilerplate, after the parameters of SDP.
+static const uint8_t full_seg_tail[] = {
+	0x20, 0x5f,
+	// Set Display Format (SDF)
+	0x9b, '5', '0', '0', ';', '1', '3', '3', 0x20, 0x56,
+	// Character composition dot designation (SSM)
+	0x9b, '3', '6', ';', '3', '6', 0x20, 0x57,
+	// Set Horizontal Spacing (SHS)
+	0x9b, '2', 0x20, 0x58,
+	// Set Vertical Spacing (SVS)
+	0x9b, '0', '8', 0x20, 0x59,
+	// Raster Colour Command (RCS)
+	0x9b, '8', 0x20, 0x6e,
+	// SSZ (small size)
+	0x88,
+	// WHF (white foreground)
+	0x87,
+	// COL (colour controls), background color - black
+	0x90, 0x50,
+};
+
+static_assert(sizeof full_seg_head + 7 + sizeof full_seg_tail
+	== CAPTION_LAYOUT_SIZE, "FULL_SEG boilerplate size");
+
+static const uint8_t one_seg_boilerplate[] = {
+	// CS (clear screen)
+	0x0c,
+	// WHF (white foreground)
+	0x87,
+	// MSZ (Middle Size)
+	0x89,
+	// APR (active position return)
+	0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d,
+};
+
+static size_t boilerplate_size(const CaptionStream *cs)
+{
+	return cs->config.seg_type == FULL_SEG
+		? CAPTION_LAYOUT_SIZE : sizeof one_seg_boilerplate;
+}
+
+static void put_decimal3(uint8_t *to, const int n)
+{
+	assert(n >= 0 && n <= 999);
+	to[0] = '0' + n / 100;
+	to[1] = '0' + n / 10 % 10;
+	to[2] = '0' + n % 10;
+}
+
+// Boilerplate every statement of cs starts with. The FULL_SEG one is
+// built once per display position and then only referenced.
+static const uint8_t *boilerplate(CaptionStream *cs)
+{
+	if(cs->config.seg_type != FULL_SEG) {
+		return one_seg_boilerplate;
+	}
+
+	if(!cs->layout_valid || cs->layout_x != cs->config.sdp_x
+		|| cs->layout_y != cs->config.sdp_y)
+	{
+		uint8_t *buf = cs->layout;
+		size_t i = 0;
+
+		memcpy(buf, full_seg_head, sizeof full_seg_head);
+		i += sizeof full_seg_head;
+		put_decimal3(&buf[i], cs->config.sdp_x);
+		buf[i + 3] = ';';
+		put_decimal3(&buf[i + 4], cs->config.sdp_y);
+		i += 7;
+		memcpy(&buf[i], full_seg_tail, sizeof full_seg_tail);
+
+		cs->layout_x = cs->config.sdp_x;
+		cs->layout_y = cs->config.sdp_y;
+		cs->layout_valid = true;
+	}
+	return cs->layout;
+}
+
+static void subtitle_boilerplate(CaptionStream *cs, Buffer *data)
+{
+	// The packet references the template rather than a copy of it,
+	// which is why it may not change while packets are queued.
+	buffer_prepend_ref(data, boilerplate(cs), boilerplate_size(cs));
+
+	data_unit(&cs->dg, STATEMENT_1, STATEMENT_BODY, data);
+}
+
+// Encodes the statement text in out into PES packets. out must have
+// room after the text for the padding byte and the CRC.
+static void caption_statement(CaptionStream *cs, Buffer *out)
+{
+	// Ensures the 2 CRC bytes in caption data_group is
+	// not split by an external TS packetizer. Our own
+	// packetizer takes care of it without padding.
+	// Captions read from input are too small to be split in more
+	// than one PES, so this is all the padding there is to decide.
+	const uint64_t start = stats_start();
+	const size_t msg_size = buffer_get_size(out);
+	const size_t payload_size = boilerplate_size(cs) + msg_size;
+	uint8_t padding = 0;
+	if(!cs->config.ts_output
+		&& (data_unit_encoded_size(STATEMENT_1, payload_size) % 184) == 1)
+	{
+		padding = 1;
+		stats_count(STATS_PADDING, 1);
+		*buffer_append(out, padding) = 0;
+	}
+
+	// Headers go before the boilerplate, in a link of their own.
+	// make check proves the size predicted above for every payload.
+	subtitle_boilerplate(cs, out);
+	stats_count(STATS_CAPTIONS, 1);
+	stats_stop(STATS_ENCODE, start);
+}
+
+// Whether line has nothing but its line ending.
+static bool line_blank(const char *line, size_t size)
+{
+	if(size && line[size - 1] == '\n') {
+		--size;
+		if(size && line[size - 1] == '\r') {
+			--size;
+		}
+	}
+	return size == 0;
+}
+
+// Whether the encoded text shows anything, besides line endings.
+static bool encoded_visible(const uint8_t *text, const size_t size)
+{
+	for(size_t i = 0; i < size; ++i) {
+		if(text[i] != '\n' && text[i] != '\r') {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool caption_push_line(CaptionStream *cs, Arena *arena,
+	const char *line, size_t size, Buffer *out)
+{
+	if(cs->line_count == 0) {
+		cs->text_size = 0;
+		charset_reset(&cs->charset);
+
+		uint64_t ms;
+		size_t n;
+		if(cs->config.pts_source == PTS_TIMECODE
+			&& (n = pts_parse_timecode(line, size, &ms)))
+		{
+			caption_set_time(cs, ms);
+			line += n;
+			size -= n;
+		}
+	}
+
+	uint8_t *msg = &cs->msg[cs->count];
+	const size_t room = sizeof cs->msg - 1 - cs->count;
+
+	size_t ncount = 0;
+	if(cs->config.seg_type == FULL_SEG) {
+		// APS (active position set), to the start of the line
+		msg[ncount++] = 0x1c;
+		msg[ncount++] = 0x4d + cs->line_count;
+		msg[ncount++] = 0x40;
+	} else {
+		// APR (active position return)
+		msg[ncount++] = 0x0d;
+	}
+
+	const uint64_t start = stats_start();
+	const size_t avail = room > ncount ? room - ncount : 0;
+	const size_t n = avail ? charset_encode(&cs->charset, line, size,
+		&msg[ncount], avail) : 0;
+	stats_stop(STATS_CHARSET, start);
+
+	// The encoder only stops early for a character that doesn't fit.
+	const bool full = avail - n < CHARSET_MAX_CHAR;
+	const bool visible = encoded_visible(&msg[ncount], n);
+
+	if(line_blank(line, size) || (!visible && full)) {
+		// A blank line ends the caption, if it has any line yet, and
+		// so does one with no room left for it.
+		if(cs->line_count == 0) {
+			return false;
+		}
+	} else if(!visible) {
+		// Only characters the caption sets don't have: the line is
+		// dropped, not taken for a blank one.
+		return false;
+	} else {
+		if(cs->config.keep_text) {
+			if(size > sizeof cs->text - 1 - cs->text_size) {
+				size = sizeof cs->text - 1 - cs->text_size;
+			}
+			memcpy(&cs->text[cs->text_size], line, size);
+			stats_count(STATS_COPIED_BYTES, size);
+			cs->text_size += size;
+			cs->text[cs->text_size] = 0;
+		}
+
+		cs->count += ncount + n;
+		++cs->line_count;
+		if(cs->line_count < cs->config.lines) {
+			return false;
+		}
+	}
+
+	return caption_flush(cs, arena, out);
+}
+
+bool caption_flush(CaptionStream *cs, Arena *arena, Buffer *out)
+{
+	if(cs->line_count == 0) {
+		return false;
+	}
+
+	// The one copy of the text, into the link it's sent from, with
+	// room for the padding byte and the CRC.
+	memcpy(buffer_init_reserved(out, arena, cs->count, 0, STATEMENT_TAILROOM),
+		cs->msg, cs->count);
+	stats_count(STATS_COPIED_BYTES, cs->count);
+	caption_statement(cs, out);
+
+	cs->count = 0;
+	cs->line_count = 0;
+
+	return true;
+}
+
+void caption_clear(CaptionStream *cs, Arena *arena, Buffer *out)
+{
+	// The boilerplate starts with CS, which is all it takes.
+	buffer_init_reserved(out, arena, 0, 0, STATEMENT_TAILROOM);
+	caption_statement(cs, out);
+}
+
+void caption_set_time(CaptionStream *cs, uint64_t ms)
+{
+	cs->dg.pes.pts = pts_add_ms(cs->config.pts_origin, ms);
+}
+
+void caption_management(CaptionStream *cs, Arena *arena, Buffer *out)
+{
+	// Management data only changes with the data group version,
+	// so the packet is encoded once and then resent with a new PTS.
+	if(!cs->management_size || cs->management_groupB != cs->dg.groupB
+		|| cs->management_version != cs->dg.version)
+	{
+		Buffer data;
+		buffer_init_reserved(&data, arena, 0,
+			CAPTION_HEADROOM, CAPTION_TAILROOM);
+		caption_management_data(&cs->dg, OLD_MANAGEMENT, &data);
+
+		// This packet should have small fixed size below 184 bytes
+		// and cause no trouble with divided CRC bytes.
+		const size_t size = buffer_get_size(&data);
+		assert(size <= sizeof cs->management);
+
+		BufferReader r;
+		buffer_reader_init(&r, &data);
+		cs->management_size = buffer_read(&r, cs->management, size);
+		buffer_destroy(&data);
+
+		cs->management_groupB = cs->dg.groupB;
+		cs->management_version = cs->dg.version;
+	} else {
+		PES_update_PTS(&cs->dg.pes, cs->management);
+	}
+
+	*out = (Buffer){.arena = arena};
+	buffer_prepend_ref(out, cs->management, cs->management_size);
+}
+
+void caption_next_packet(CaptionStream *cs, Arena *arena,
+	Buffer *pes, Buffer *out)
+{
+	if(!cs->config.ts_output) {
+		buffer_chop_head(pes, PES_next_packet_size(pes), out);
+		return;
+	}
+
+	Buffer head;
+	buffer_chop_head(pes, PES_next_packet_size(pes), &head);
+
+	const size_t size = TS_packetized_size(buffer_get_size(&head));
+	buffer_init_reserved(out, arena, 0, 0, size);
+	TS_packetize(&cs->ts, &head, out);
+
+	buffer_destroy(&head);
+}
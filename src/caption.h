@@ -0,0 +1,131 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "buffer.h"
+#include "charset.h"
+#include "data-group.h"
+#include "TS-write.h"
+
+// Caption management data is sent once every this many seconds.
+#define CAPTION_MANAGEMENT_INTERVAL 1.0
+
+// Longest caption statement text, in bytes.
+#define CAPTION_MAX_TEXT 4096
+
+// Most lines of a caption read from input: the APS row of the last
+// one, 0x4d plus its index, can't go past 0x7f, the highest APS
+// parameter.
+#define CAPTION_MAX_LINES (0x7f - 0x4d + 1)
+
+// Size of the control codes starting every FULL_SEG statement.
+#define CAPTION_LAYOUT_SIZE 50
+
+// Settings of a caption stream, as given in the command line.
+struct CaptionConfig
+{
+	SegType seg_type;
+
+	// Set Display Position, in the FULL_SEG boilerplate
+	int sdp_x, sdp_y;
+
+	// Input lines per caption
+	int lines;
+
+	// Keep the input lines of each caption in text, for debugging.
+	bool keep_text;
+
+	// Emit MPEG-TS instead of bare PES, with no PSI, see TSStream.
+	bool ts_output;
+	uint16_t pid;
+
+	// With PTS_TIMECODE, the first line of a caption may start with
+	// the time it's presented at, counted from pts_origin.
+	PTSSource pts_source;
+	uint64_t pts_origin;
+};
+typedef struct CaptionConfig CaptionConfig;
+
+#define CAPTION_CONFIG_DEFAULT { \
+	.seg_type = FULL_SEG, \
+	.sdp_x = 150, .sdp_y = 350, \
+	.lines = 2, \
+	.keep_text = false, \
+	.ts_output = false, \
+	.pid = 0x100, \
+	.pts_source = PTS_WALL_CLOCK, \
+	.pts_origin = 0, \
+}
+
+// Everything needed to encode one caption service. Streams share
+// no state, so a process may encode any number of them.
+struct CaptionStream
+{
+	CaptionConfig config;
+	DataGroupStream dg;
+	TSStream ts;
+
+	// Caption being assembled from input lines, converted here so
+	// that it holds no arena memory until it's complete: the caller
+	// may reset the arena after every packet.
+	CharsetState charset;
+	uint8_t msg[CAPTION_MAX_TEXT];
+	size_t count;
+	int line_count;
+
+	// FULL_SEG boilerplate for the display position it was built
+	// for. Queued packets reference it, so it's rebuilt only when
+	// that position changes.
+	uint8_t layout[CAPTION_LAYOUT_SIZE];
+	int layout_x, layout_y;
+	bool layout_valid;
+
+	// Management packet, for the data group version it was encoded
+	// with, sent again with only its PTS updated.
+	uint8_t management[184];
+	size_t management_size;
+	bool management_groupB;
+	uint8_t management_version;
+
+	// Input lines of the last caption, with keep_text.
+	char text[CAPTION_MAX_TEXT];
+	size_t text_size;
+};
+typedef struct CaptionStream CaptionStream;
+
+void caption_stream_init(CaptionStream *cs, const CaptionConfig *config);
+void caption_stream_destroy(CaptionStream *cs);
+
+//! Adds an input line, with its '\n', to the caption being assembled.
+//! With PTS_TIMECODE, a timecode starting the first line sets the PTS
+//! of the caption, and of the ones after it that have none.
+//! If that completes the caption, encodes it as PES packets into out,
+//! which is assumed deallocated, and returns true. out is built on
+//! arena, which holds nothing of the lines before that.
+bool caption_push_line(CaptionStream *cs, Arena *arena,
+	const char *line, size_t size, Buffer *out);
+
+//! Completes the caption being assembled with the lines it has so
+//! far. If it has any, encodes it into out, which is assumed
+//! deallocated, and returns true. out is built on the arena given
+//! with the lines.
+bool caption_flush(CaptionStream *cs, Arena *arena, Buffer *out);
+
+//! Encodes a caption with no text, which clears the screen, into out,
+//! which is assumed deallocated.
+void caption_clear(CaptionStream *cs, Arena *arena, Buffer *out);
+
+//! Sets the PTS of what is encoded next to ms milliseconds after
+//! pts_origin. Has effect unless PTS comes from the wall clock.
+void caption_set_time(CaptionStream *cs, uint64_t ms);
+
+//! Encodes the caption management data as a PES packet into out,
+//! which is assumed deallocated. out references a packet cached in
+//! cs, and must be written before the next call.
+void caption_management(CaptionStream *cs, Arena *arena, Buffer *out);
+
+//! Moves the first PES packet in pes to out, which is assumed
+//! deallocated, converted to the output format of the stream.
+void caption_next_packet(CaptionStream *cs, Arena *arena,
+	Buffer *pes, Buffer *out);
@@ -0,0 +1,159 @@
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "jis-table.h"
+
+#include "charset.h"
+
+// Control codes of ARIB STD-B24, Table 7-14.
+#define LS0 0x0f
+#define LS1 0x0e
+#define ESC 0x1b
+
+// Final byte designating the Kanji set, in ARIB STD-B24.
+#define KANJI_SET 0x42
+
+void charset_reset(CharsetState *state)
+{
+	memset(state, 0, sizeof *state);
+}
+
+// Length of the run of 7-bit bytes at the start of text.
+static size_t ascii_run(const uint8_t *text, const size_t size)
+{
+	size_t i = 0;
+#ifdef __SSE2__
+	for(; i + 16 <= size; i += 16) {
+		const __m128i v = _mm_loadu_si128((const __m128i *)(text + i));
+		const int mask = _mm_movemask_epi8(v);
+		if(mask) {
+			return i + __builtin_ctz(mask);
+		}
+	}
+#endif
+	while(i < size && text[i] < 0x80) {
+		++i;
+	}
+	return i;
+}
+
+// Decodes the UTF-8 sequence of a non-ASCII code point at text.
+// Returns its length, or 0 if malformed.
+static size_t decode_utf8(const uint8_t *text, const size_t size,
+	uint32_t *cp)
+{
+	size_t len;
+	uint32_t min;
+	if(text[0] >= 0xc2 && text[0] <= 0xdf) {
+		len = 2;
+		min = 0x80;
+		*cp = text[0] & 0x1f;
+	} else if(text[0] >= 0xe0 && text[0] <= 0xef) {
+		len = 3;
+		min = 0x800;
+		*cp = text[0] & 0x0f;
+	} else if(text[0] >= 0xf0 && text[0] <= 0xf4) {
+		len = 4;
+		min = 0x10000;
+		*cp = text[0] & 0x07;
+	} else {
+		return 0;
+	}
+
+	if(len > size) {
+		return 0;
+	}
+	for(size_t i = 1; i < len; ++i) {
+		if((text[i] & 0xc0) != 0x80) {
+			return 0;
+		}
+		*cp = *cp << 6 | (text[i] & 0x3f);
+	}
+	if(*cp < min || *cp > 0x10ffff || (*cp >= 0xd800 && *cp <= 0xdfff)) {
+		return 0;
+	}
+	return len;
+}
+
+size_t charset_encode(CharsetState *state, const char *text, size_t size,
+	uint8_t *out, const size_t out_size)
+{
+	const uint8_t *in = (const uint8_t *)text;
+	size_t o = 0;
+
+	while(size) {
+		if(in[0] < 0x80) {
+			// Control codes and space mean the same whatever GL
+			// invokes, so LS0 is only needed before a graphic.
+			if(state->gl_g1 && in[0] > 0x20 && in[0] < 0x7f) {
+				if(o == out_size) {
+					break;
+				}
+				out[o++] = LS0;
+				state->gl_g1 = false;
+			}
+
+			size_t n = state->gl_g1 ? 1 : ascii_run(in, size);
+			if(n > out_size - o) {
+				n = out_size - o;
+				if(!n) {
+					break;
+				}
+			}
+			memcpy(out + o, in, n);
+			o += n;
+			in += n;
+			size -= n;
+			continue;
+		}
+
+		uint32_t cp;
+		const size_t len = decode_utf8(in, size, &cp);
+		if(!len) {
+			// Malformed, drop the byte and resync on the next.
+			++in;
+			--size;
+			continue;
+		}
+
+		if(cp >= 0xa0 && cp <= 0xff) {
+			// Latin extension, invoked in GR.
+			if(o == out_size) {
+				break;
+			}
+			out[o++] = cp;
+		} else {
+			const uint16_t jis = jis_table_lookup(cp);
+			if(jis) {
+				const size_t need = 2 + (state->g1_kanji ? 0 : 4)
+					+ (state->gl_g1 ? 0 : 1);
+				if(need > out_size - o) {
+					break;
+				}
+				if(!state->g1_kanji) {
+					// Designate the 2-byte Kanji set to G1.
+					out[o++] = ESC;
+					out[o++] = 0x24;
+					out[o++] = 0x29;
+					out[o++] = KANJI_SET;
+					state->g1_kanji = true;
+				}
+				if(!state->gl_g1) {
+					out[o++] = LS1;
+					state->gl_g1 = true;
+				}
+				out[o++] = jis >> 8;
+				out[o++] = jis & 0xff;
+			}
+			// Anything else has no code in the sets at hand,
+			// C1 controls included.
+		}
+		in += len;
+		size -= len;
+	}
+
+	return o;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Code set state of the caption decoder, as left by the bytes encoded
+// so far. In the initial state of a caption statement for ISDB-Tb, GL
+// invokes G0, holding the alphanumeric set, and GR the Latin extension,
+// which is laid out as the upper half of Latin-1.
+// Most bytes charset_encode() writes for a single character: the
+// Kanji set designation, LS1 and the character itself.
+#define CHARSET_MAX_CHAR 7
+
+struct CharsetState
+{
+	// G1 was designated the Kanji set.
+	bool g1_kanji;
+	// GL invokes G1 (LS1), rather than G0 (LS0).
+	bool gl_g1;
+};
+typedef struct CharsetState CharsetState;
+
+//! Back to the state at the start of a caption statement.
+void charset_reset(CharsetState *state);
+
+//! Encodes UTF-8 text as ARIB STD-B24 8-bit codes: ASCII and C0 as
+//! they are, Latin-1 through the Latin extension in GR, and JIS X 0208
+//! (kanji and kana) through the Kanji set in GL, designating and
+//! invoking sets as needed. Characters in none of them, and malformed
+//! UTF-8, are dropped. Stops before the first character that doesn't
+//! fit in out. Returns the number of bytes written.
+size_t charset_encode(CharsetState *state, const char *text, size_t size,
+	uint8_t *out, size_t out_size);
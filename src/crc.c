@@ -0,0 +1,182 @@
+#include <string.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_CLMUL 1
+#endif
+
+#include "crc.h"
+
+#define CRC16_POLY 0x1021
+
+// slice_table[k][i] is the CRC of byte i followed by k zero bytes.
+static uint16_t slice_table[8][256];
+
+static CRC16Func crc16_impl = crc16_update_bitwise;
+
+uint16_t crc16_update_bitwise(uint16_t crc, const uint8_t *data, size_t size)
+{
+	for(size_t c = 0; c < size; ++c) {
+		crc ^= (uint16_t)data[c] << 8;
+		for(uint8_t i = 0; i < 8; ++i) {
+			if(crc & 0x8000) {
+				crc = (crc << 1) ^ CRC16_POLY;
+			} else {
+				crc <<= 1;
+			}
+		}
+	}
+	return crc;
+}
+
+static uint16_t crc16_update_byte(uint16_t crc, const uint8_t *data, size_t size)
+{
+	for(size_t c = 0; c < size; ++c) {
+		crc = (crc << 8) ^ slice_table[0][(crc >> 8) ^ data[c]];
+	}
+	return crc;
+}
+
+uint16_t crc16_update_slice8(uint16_t crc, const uint8_t *data, size_t size)
+{
+	while(size >= 8) {
+		// The 16 bits of CRC state simply add to the first 2 message bytes.
+		crc = slice_table[7][data[0] ^ (crc >> 8)]
+			^ slice_table[6][data[1] ^ (crc & 0xff)]
+			^ slice_table[5][data[2]]
+			^ slice_table[4][data[3]]
+			^ slice_table[3][data[4]]
+			^ slice_table[2][data[5]]
+			^ slice_table[1][data[6]]
+			^ slice_table[0][data[7]];
+		data += 8;
+		size -= 8;
+	}
+	return crc16_update_byte(crc, data, size);
+}
+
+#ifdef HAVE_CLMUL
+// x^n mod P, used as folding constants.
+static uint64_t xpow_mod(unsigned n)
+{
+	uint16_t r = 1;
+	while(n--) {
+		r = (r & 0x8000) ? (r << 1) ^ CRC16_POLY : r << 1;
+	}
+	return r;
+}
+
+static uint64_t fold512_hi, fold512_lo, fold128_hi, fold128_lo;
+
+// Parallel folding with carry-less multiplication, as in Intel's
+// "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ",
+// for the non-reflected case. Four 128-bit lanes are folded 512 bits
+// forward at a time, then merged into a single 128-bit value congruent
+// to the message, whose CRC is finished with the tables.
+__attribute__((target("pclmul,ssse3")))
+static uint16_t crc16_update_clmul(uint16_t crc, const uint8_t *data, size_t size)
+{
+	if(size < 64) {
+		return crc16_update_slice8(crc, data, size);
+	}
+
+	const __m128i bswap = _mm_set_epi8(
+		0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	const __m128i k512 = _mm_set_epi64x(fold512_hi, fold512_lo);
+	const __m128i k128 = _mm_set_epi64x(fold128_hi, fold128_lo);
+
+	uint8_t first[16];
+	memcpy(first, data, 16);
+	first[0] ^= crc >> 8;
+	first[1] ^= crc & 0xff;
+
+	__m128i x[4];
+	x[0] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)first), bswap);
+	for(int i = 1; i < 4; ++i) {
+		x[i] = _mm_shuffle_epi8(
+			_mm_loadu_si128((const __m128i *)(data + 16 * i)), bswap);
+	}
+	data += 64;
+	size -= 64;
+
+	while(size >= 64) {
+		for(int i = 0; i < 4; ++i) {
+			const __m128i b = _mm_shuffle_epi8(
+				_mm_loadu_si128((const __m128i *)(data + 16 * i)), bswap);
+			x[i] = _mm_xor_si128(
+				_mm_xor_si128(_mm_clmulepi64_si128(x[i], k512, 0x11),
+					_mm_clmulepi64_si128(x[i], k512, 0x00)), b);
+		}
+		data += 64;
+		size -= 64;
+	}
+
+	__m128i r = x[0];
+	for(int i = 1; i < 4; ++i) {
+		r = _mm_xor_si128(
+			_mm_xor_si128(_mm_clmulepi64_si128(r, k128, 0x11),
+				_mm_clmulepi64_si128(r, k128, 0x00)), x[i]);
+	}
+	while(size >= 16) {
+		const __m128i b = _mm_shuffle_epi8(
+			_mm_loadu_si128((const __m128i *)data), bswap);
+		r = _mm_xor_si128(
+			_mm_xor_si128(_mm_clmulepi64_si128(r, k128, 0x11),
+				_mm_clmulepi64_si128(r, k128, 0x00)), b);
+		data += 16;
+		size -= 16;
+	}
+
+	uint8_t rem[16];
+	_mm_storeu_si128((__m128i *)rem, _mm_shuffle_epi8(r, bswap));
+
+	crc = crc16_update_slice8(0, rem, 16);
+	return crc16_update_slice8(crc, data, size);
+}
+#endif
+
+CRC16Func crc16_clmul_func(void)
+{
+#ifdef HAVE_CLMUL
+	__builtin_cpu_init();
+	if(__builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3")) {
+		return crc16_update_clmul;
+	}
+#endif
+	return NULL;
+}
+
+// Runs before main(), so the dispatch pointer and tables are
+// never written while encoder threads are running.
+__attribute__((constructor))
+static void crc16_init(void)
+{
+	for(unsigned i = 0; i < 256; ++i) {
+		const uint8_t byte = i;
+		slice_table[0][i] = crc16_update_bitwise(0, &byte, 1);
+	}
+	for(unsigned k = 1; k < 8; ++k) {
+		for(unsigned i = 0; i < 256; ++i) {
+			const uint16_t prev = slice_table[k - 1][i];
+			slice_table[k][i] = (prev << 8) ^ slice_table[0][prev >> 8];
+		}
+	}
+	crc16_impl = crc16_update_slice8;
+
+#ifdef HAVE_CLMUL
+	fold512_hi = xpow_mod(512 + 64);
+	fold512_lo = xpow_mod(512);
+	fold128_hi = xpow_mod(128 + 64);
+	fold128_lo = xpow_mod(128);
+
+	CRC16Func clmul = crc16_clmul_func();
+	if(clmul) {
+		crc16_impl = clmul;
+	}
+#endif
+}
+
+uint16_t crc16_update(uint16_t crc, const uint8_t *data, size_t size)
+{
+	return crc16_impl(crc, data, size);
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// CRC-16/CCITT as required by ARIB STD-B24, Chapter 9 for data groups:
+// polynomial x^16 + x^12 + x^5 + 1 (0x1021), initial value 0,
+// not reflected, no final xor.
+
+//! Folds size bytes of data into crc. Start with crc = 0 and feed the
+//! chunks in order; the result after the last chunk is the CRC of the
+//! concatenation.
+uint16_t crc16_update(uint16_t crc, const uint8_t *data, size_t size);
+
+// Individual implementations, all yielding the same result as
+// crc16_update(). crc16_update() dispatches to the fastest one
+// supported by the running CPU.
+uint16_t crc16_update_bitwise(uint16_t crc, const uint8_t *data, size_t size);
+uint16_t crc16_update_slice8(uint16_t crc, const uint8_t *data, size_t size);
+
+//! Returns NULL if carry-less multiplication is unsupported by the CPU.
+typedef uint16_t (*CRC16Func)(uint16_t crc, const uint8_t *data, size_t size);
+CRC16Func crc16_clmul_func(void);
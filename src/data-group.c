@@ -7,13 +7,30 @@
 
 #include "PES-write.h"
 
-static void data_group_packet(uint8_t header,
+// Sizes of the structures wrapping each layer, ARIB STD-B24, Chapter 9.
+#define DATA_GROUP_HEADER_SIZE 5
+#define DATA_GROUP_CRC_SIZE 2
+#define DATA_GROUP_MAX_SIZE 0xffff
+#define MANAGEMENT_HEADER_SIZE 10
+#define STATEMENT_HEADER_SIZE 4
+#define DATA_UNIT_HEADER_SIZE 5
+
+// Most data in one data group of a chain, for the whole group, header
+// and CRC included, to fill at most one PES packet: a PES starts with
+// a data group, so decoders find every group by its PES alone.
+#define DATA_GROUP_MAX_PIECE \
+	(PES_MAX_PAYLOAD - DATA_GROUP_HEADER_SIZE - DATA_GROUP_CRC_SIZE)
+
+static_assert(DATA_GROUP_MAX_PIECE <= DATA_GROUP_MAX_SIZE,
+	"data_group_size of a piece");
+
+static void data_group_packet(DataGroupStream *ds, uint8_t header,
 	uint8_t link_number, uint8_t last_link_number, Buffer *data)
 {
 	size_t size = buffer_get_size(data);
 
 	// Header bytes
-	uint8_t *h = buffer_prepend(data, 5);
+	uint8_t *h = buffer_prepend(data, DATA_GROUP_HEADER_SIZE);
 
 	// data_group_id, data_group_version
 	h[0] = header;
@@ -25,56 +42,59 @@ static void data_group_packet(uint8_t header,
 	h[2] = last_link_number;
 
 	// data_group_size, in big-endian
-	assert(size <= 0xffff);
+	assert(size <= DATA_GROUP_MAX_SIZE);
 	h[3] = size >> 8;
 	h[4] = size & 0xff;
 
 	// CRC_16 bytes
-	uint16_t crc = buffer_CRC16(data);
-	*((uint16_t *)buffer_append(data, 2)) = ntohs(crc);
+	const uint16_t crc = buffer_CRC16(data);
+	uint8_t *c = buffer_append(data, DATA_GROUP_CRC_SIZE);
+	c[0] = crc >> 8;
+	c[1] = crc & 0xff;
 
-	PES_packetize(data);
+	PES_packetize(&ds->pes, data);
 }
 
-static void data_group_packetize(CaptionDataType cdt, Buffer *data)
+static void data_group_packetize(DataGroupStream *ds,
+	CaptionDataType cdt, Buffer *data)
 {
 	// Assemble data group chain as described in ARIB STD-B24, Chapter 9
-	static bool groupB = false;
-	static uint8_t version = 0;
-
 	if(cdt == NEW_MANAGEMENT) {
-		groupB = !groupB;
-		version = (version + 1) & 0b11;
+		ds->groupB = !ds->groupB;
+		ds->version = (ds->version + 1) & 0b11;
 		cdt = OLD_MANAGEMENT;
 	}
 
 	uint8_t data_group_id = (uint8_t)cdt;
-	if(groupB) {
+	if(ds->groupB) {
 		data_group_id += 0x20;
 	}
 
-	const uint8_t header = (data_group_id << 2) | version;
+	const uint8_t header = (data_group_id << 2) | ds->version;
 
+	// Data too big for a single PES packet is carried by a chain of
+	// groups numbered by data_group_link_number, a packet each.
 	const size_t size = buffer_get_size(data);
-	/* // TODO: fix packetization.
-	assert(size / UINT16_MAX < 256
-			|| (size / UINT16_MAX == 256 && size % UINT16_MAX == 0));
+	size_t npieces = (size + DATA_GROUP_MAX_PIECE - 1) / DATA_GROUP_MAX_PIECE;
+	if(npieces == 0) {
+		npieces = 1;
+	}
+	assert(npieces <= 256);
 
-	const uint8_t last_piece = size / UINT16_MAX - 1
-		+ ((size % UINT16_MAX) != 0);
+	const uint8_t last_piece = npieces - 1;
 
-	uint8_t i = 0;
-	while(size > UINT16_MAX) {
+	Buffer out = {.arena = data->arena};
+	for(uint8_t i = 0; i < last_piece; ++i) {
 		Buffer head;
-		buffer_chop_head(data, UINT16_MAX, &head);
+		buffer_chop_head(data, DATA_GROUP_MAX_PIECE, &head);
 
-		data_group_packet(header, i++, last_piece, &head);
-		buffer_destroy(&head);
+		data_group_packet(ds, header, i, last_piece, &head);
+		buffer_concat(&out, &head);
 	}
-	data_group_packet(header, i, last_piece, data);
-	*/
-	assert(size <= UINT16_MAX);
-	data_group_packet(header, 0, 0, data);
+	data_group_packet(ds, header, last_piece, last_piece, data);
+	buffer_concat(&out, data);
+
+	*data = out;
 }
 
 static void set_3_byte_data(uint8_t *to, uint32_t value)
@@ -88,15 +108,15 @@ static void set_3_byte_data(uint8_t *to, uint32_t value)
 	to[2] = value & 0xff;
 }
 
-void caption_management_data(CaptionDataType cd_type,
-	Buffer *data)
+void caption_management_data(DataGroupStream *ds,
+	CaptionDataType cd_type, Buffer *data)
 {
 	// Struct from ARIB STD-B24, Table 9-3
 	const size_t data_size = buffer_get_size(data);
 	assert(cd_type == NEW_MANAGEMENT || cd_type == OLD_MANAGEMENT);
 	assert(data_size < 0xffffff);
 
-	uint8_t *buf = buffer_prepend(data, 10);
+	uint8_t *buf = buffer_prepend(data, MANAGEMENT_HEADER_SIZE);
 
 	// TMD (free), '111111'
 	buf[0] = 0b00111111;
@@ -116,10 +136,11 @@ void caption_management_data(CaptionDataType cd_type,
 	// data_unit_loop_length
 	set_3_byte_data(&buf[7], data_size);
 
-	data_group_packetize(cd_type, data);
+	data_group_packetize(ds, cd_type, data);
 }
 
-static void caption_statement_data(CaptionDataType cd_type, Buffer *data)
+static void caption_statement_data(DataGroupStream *ds,
+	CaptionDataType cd_type, Buffer *data)
 {
 	// Struct from ARIB STD-B24, Table 9-10
 	const size_t data_size = buffer_get_size(data);
@@ -127,7 +148,7 @@ static void caption_statement_data(CaptionDataType cd_type, Buffer *data)
 	assert(data_size > 0);
 	assert(data_size < 0xffffff);
 
-	uint8_t *buf = buffer_prepend(data, 4);
+	uint8_t *buf = buffer_prepend(data, STATEMENT_HEADER_SIZE);
 
 	// TMD (free), '111111'
 	buf[0] = 0b00111111;
@@ -135,14 +156,38 @@ static void caption_statement_data(CaptionDataType cd_type, Buffer *data)
 	// data_unit_loop_length
 	set_3_byte_data(&buf[1], data_size);
 
-	data_group_packetize(cd_type, data);
+	data_group_packetize(ds, cd_type, data);
+}
+
+size_t data_unit_encoded_size(CaptionDataType cd_type, size_t data_size)
+{
+	size_t size = DATA_UNIT_HEADER_SIZE + data_size;
+
+	if(cd_type == NEW_MANAGEMENT || cd_type == OLD_MANAGEMENT) {
+		size += MANAGEMENT_HEADER_SIZE;
+	} else {
+		size += STATEMENT_HEADER_SIZE;
+	}
+
+	// Each piece of the data group chain is a separate PES.
+	size_t ret = 0;
+	do {
+		const size_t piece = size < DATA_GROUP_MAX_PIECE ?
+			size : DATA_GROUP_MAX_PIECE;
+		ret += PES_packetized_size(
+			DATA_GROUP_HEADER_SIZE + piece + DATA_GROUP_CRC_SIZE);
+		size -= piece;
+	} while(size);
+
+	return ret;
 }
 
-void data_unit(CaptionDataType cd_type, DataUnitType du_type, Buffer *data)
+void data_unit(DataGroupStream *ds,
+	CaptionDataType cd_type, DataUnitType du_type, Buffer *data)
 {
 	// Struct from ARIB STD-B24, Table 9-11
 	const size_t data_size = buffer_get_size(data);
-	uint8_t *buf = buffer_prepend(data, 5);
+	uint8_t *buf = buffer_prepend(data, DATA_UNIT_HEADER_SIZE);
 
 	// unit_separator
 	buf[0] = 0x1f;
@@ -154,8 +199,8 @@ void data_unit(CaptionDataType cd_type, DataUnitType du_type, Buffer *data)
 	set_3_byte_data(&buf[2], data_size);
 
 	if(cd_type == NEW_MANAGEMENT || cd_type == OLD_MANAGEMENT) {
-		caption_management_data(cd_type, data);
+		caption_management_data(ds, cd_type, data);
 	} else {
-		caption_statement_data(cd_type, data);
+		caption_statement_data(ds, cd_type, data);
 	}
 }
@@ -1,8 +1,10 @@
 #pragma once
 
+#include <stdbool.h>
 #include <stdio.h>
 #include <stdint.h>
 #include "buffer.h"
+#include "PES-write.h"
 
 enum CaptionDataType
 {
@@ -31,6 +33,22 @@ enum DataUnitType
 };
 typedef enum DataUnitType DataUnitType;
 
-void caption_management_data(CaptionDataType cd_type, Buffer *data);
+// State of the data group chain of one caption stream,
+// as described in ARIB STD-B24, Chapter 9.
+struct DataGroupStream
+{
+	PESStream pes;
+	bool groupB;
+	uint8_t version;
+};
+typedef struct DataGroupStream DataGroupStream;
+
+//! Size of the PES output of data_unit() for data_size bytes of data,
+//! known before running the encoder.
+size_t data_unit_encoded_size(CaptionDataType cd_type, size_t data_size);
+
+void caption_management_data(DataGroupStream *ds,
+	CaptionDataType cd_type, Buffer *data);
 
-void data_unit(CaptionDataType cd_type, DataUnitType du_type, Buffer *data);
+void data_unit(DataGroupStream *ds,
+	CaptionDataType cd_type, DataUnitType du_type, Buffer *data);
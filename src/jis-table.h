@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stdint.h>
+
+// JIS X 0208 code, row in the high byte, of every BMP code point it
+// holds, or 0, in pages of 256 code points. jis_page_index has the
+// page of code points U+hh00 to U+hhff in jis_pages, or 0, an empty
+// page, if none of them has a code.
+extern const uint8_t jis_page_index[256];
+extern const uint16_t jis_pages[][256];
+
+static inline uint16_t jis_table_lookup(const uint32_t cp)
+{
+	if(cp >= 0x10000) {
+		return 0;
+	}
+	return jis_pages[jis_page_index[cp >> 8]][cp & 0xff];
+}
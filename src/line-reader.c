@@ -0,0 +1,76 @@
+#define _POSIX_C_SOURCE 200809L
+#include <assert.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "line-reader.h"
+
+void line_reader_init(LineReader *r, const int fd, const size_t max_line)
+{
+	memset(r, 0, sizeof *r);
+	r->fd = fd;
+	r->max_line = max_line;
+	// Room for a whole block past the longest unfinished line.
+	r->capacity = max_line + LINE_READER_BLOCK;
+	r->buf = malloc(r->capacity);
+}
+
+void line_reader_destroy(LineReader *r)
+{
+	free(r->buf);
+	r->buf = NULL;
+}
+
+ssize_t line_reader_fill(LineReader *r)
+{
+	// Whatever is left is shorter than max_line, or it would
+	// have been taken as a line.
+	assert(line_reader_pending(r) < r->max_line);
+
+	if(r->start) {
+		const size_t pending = line_reader_pending(r);
+		memmove(r->buf, r->buf + r->start, pending);
+		r->scan -= r->start;
+		r->end = pending;
+		r->start = 0;
+	}
+
+	const ssize_t n = read(r->fd, r->buf + r->end, r->capacity - r->end);
+	if(n > 0) {
+		r->end += n;
+	} else if(n == 0 || (errno != EINTR && errno != EAGAIN
+		&& errno != EWOULDBLOCK))
+	{
+		r->eof = true;
+	}
+	return n;
+}
+
+bool line_reader_next(LineReader *r, LineView *line)
+{
+	size_t end;
+
+	// glibc's memchr() scans a vector register at a time.
+	const char *nl = memchr(r->buf + r->scan, '\n', r->end - r->scan);
+	if(nl) {
+		end = nl - r->buf + 1;
+		if(end - r->start > r->max_line) {
+			end = r->start + r->max_line;
+		}
+	} else if(line_reader_pending(r) >= r->max_line) {
+		end = r->start + r->max_line;
+	} else if(r->eof && r->start < r->end) {
+		// Last line, with no '\n'.
+		end = r->end;
+	} else {
+		r->scan = r->end;
+		return false;
+	}
+
+	line->data = r->buf + r->start;
+	line->size = end - r->start;
+	r->start = r->scan = end;
+	return true;
+}
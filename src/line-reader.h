@@ -0,0 +1,58 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+// Bytes asked of read() at a time.
+#define LINE_READER_BLOCK 65536
+
+// Splits the bytes of a file descriptor in lines, read in big blocks
+// into a fixed buffer. Lines are handed out as views of the buffer,
+// not copied; only the unfinished last line is moved to the front of
+// the buffer before the next block is read.
+struct LineReader
+{
+	int fd;
+	char *buf;
+	size_t capacity;
+	// Lines longer than this are split.
+	size_t max_line;
+
+	// Unconsumed bytes are buf[start, end). buf[start, scan) is
+	// known to hold no '\n'.
+	size_t start;
+	size_t scan;
+	size_t end;
+
+	// read() returned 0, or failed.
+	bool eof;
+};
+typedef struct LineReader LineReader;
+
+// A line in the buffer of a LineReader, with its '\n' if it has one.
+// Valid until the next line_reader_fill().
+struct LineView
+{
+	const char *data;
+	size_t size;
+};
+typedef struct LineView LineView;
+
+void line_reader_init(LineReader *r, int fd, size_t max_line);
+void line_reader_destroy(LineReader *r);
+
+//! Reads the next block. Only to be called after line_reader_next()
+//! returned false. Returns what read() returns; on 0 or an error other
+//! than EINTR, EAGAIN or EWOULDBLOCK, eof is set.
+ssize_t line_reader_fill(LineReader *r);
+
+//! Takes the next complete line, or the rest of the input at eof.
+//! Returns false if there is none yet.
+bool line_reader_next(LineReader *r, LineView *line);
+
+//! Bytes read but not yet taken as lines.
+static inline size_t line_reader_pending(const LineReader *r)
+{
+	return r->end - r->start;
+}
@@ -0,0 +1,589 @@
+#define _GNU_SOURCE
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include <sys/stat.h>
+
+#include "stats.h"
+#include "timer.h"
+
+#include "output.h"
+
+// Slots are handed around as in Dmitry Vyukov's bounded queue: the
+// slot for queue position pos is free when its seq is pos, and holds
+// a packet when its seq is pos + 1. Producers claim positions with a
+// CAS on tail; the writer is the only one moving head.
+
+static uint64_t to_ns(const double seconds)
+{
+	return (uint64_t)(seconds * 1e9);
+}
+
+static void wake_writer(OutputQueue *q)
+{
+	if(atomic_exchange(&q->sleeping, false)) {
+		const uint64_t one = 1;
+		while(write(q->wake_fd, &one, sizeof one) < 0 && errno == EINTR)
+			;
+	}
+}
+
+// Blocks until the writer frees slot for queue position pos.
+static void wait_slot(OutputQueue *q, OutputSlot *slot, const size_t pos)
+{
+	pthread_mutex_lock(&q->space_lock);
+	// Announced before checking, and the writer checks for waiters
+	// after freeing a slot, so either this sees the slot free or the
+	// writer sees the waiter, and signals it under the lock.
+	atomic_fetch_add(&q->space_waiters, 1);
+	while((intptr_t)(atomic_load(&slot->seq) - pos) < 0) {
+		pthread_cond_wait(&q->space, &q->space_lock);
+	}
+	atomic_fetch_sub(&q->space_waiters, 1);
+	pthread_mutex_unlock(&q->space_lock);
+}
+
+static OutputSlot *claim_slot(OutputQueue *q, size_t *pos_out)
+{
+	double full_since = 0.0;
+
+	size_t pos = atomic_load_explicit(&q->tail, memory_order_relaxed);
+	for(;;) {
+		OutputSlot *slot = &q->slots[pos % OUTPUT_QUEUE_SLOTS];
+		const size_t seq = atomic_load_explicit(&slot->seq,
+			memory_order_acquire);
+		const intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+		if(diff == 0) {
+			if(atomic_compare_exchange_weak_explicit(&q->tail, &pos, pos + 1,
+				memory_order_relaxed, memory_order_relaxed))
+			{
+				if(full_since != 0.0) {
+					q->full_ns += to_ns(time_now() - full_since);
+				}
+				*pos_out = pos;
+				return slot;
+			}
+		} else if(diff < 0) {
+			// Full: the writer is a whole queue behind.
+			if(full_since == 0.0) {
+				full_since = time_now();
+				++q->full_waits;
+			}
+			wake_writer(q);
+			wait_slot(q, slot, pos);
+			pos = atomic_load_explicit(&q->tail, memory_order_relaxed);
+		} else {
+			pos = atomic_load_explicit(&q->tail, memory_order_relaxed);
+		}
+	}
+}
+
+OutputSlot *output_queue_claim(OutputQueue *q, size_t *pos)
+{
+	return claim_slot(q, pos);
+}
+
+void output_queue_publish(OutputQueue *q, OutputSlot *slot, const size_t pos)
+{
+	size_t depth = pos + 1 - atomic_load(&q->head);
+	size_t max = atomic_load_explicit(&q->max_depth, memory_order_relaxed);
+	while(depth > max && !atomic_compare_exchange_weak(&q->max_depth,
+		&max, depth))
+		;
+
+	slot->pushed = time_now();
+	atomic_store(&slot->seq, pos + 1);
+	wake_writer(q);
+}
+
+void output_queue_push(OutputQueue *q, const Buffer *data)
+{
+	size_t pos;
+	OutputSlot *slot = output_queue_claim(q, &pos);
+
+	const size_t size = data->total_size;
+	BufferReader r;
+	buffer_reader_init(&r, data);
+	buffer_read(&r, buffer_init_reserved(&slot->data, &slot->arena,
+		size, 0, 0), size);
+
+	output_queue_publish(q, slot, pos);
+}
+
+// Blocks until fd takes more bytes, or the writer is woken up.
+static void wait_writable(OutputQueue *q)
+{
+	struct pollfd pfd = {.fd = q->fd, .events = POLLOUT};
+	const double start = time_now();
+	stats_count(STATS_WRITE_STALLS, 1);
+	int ret;
+	do {
+		++q->syscalls;
+		ret = poll(&pfd, 1, -1);
+	} while(ret < 0 && errno == EINTR);
+	q->stall_ns += to_ns(time_now() - start);
+}
+
+// Writes what's left of the slot's data, whatever it takes. Returns
+// false if the output failed for good.
+static bool write_all(OutputQueue *q, OutputSlot *slot)
+{
+	const Buffer *data = &slot->data;
+	size_t done = slot->written;
+	while(done < data->total_size) {
+		const ssize_t n = buffer_write_fd(data, q->fd, done);
+		++q->syscalls;
+		if(n < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			if(errno == EAGAIN || errno == EWOULDBLOCK) {
+				++q->would_block;
+				wait_writable(q);
+				continue;
+			}
+			perror("Failed to write output");
+			return false;
+		}
+
+		done += n;
+		if(done < data->total_size) {
+			++q->short_writes;
+		}
+	}
+
+	++q->packets;
+	q->bytes += done;
+	return true;
+}
+
+// Sleeps until a producer publishes something, or the queue is closed.
+static void wait_packet(OutputQueue *q, OutputSlot *slot, size_t pos)
+{
+	atomic_store(&q->sleeping, true);
+	// Checked again after announcing the sleep, or a packet published
+	// in between would wait for the next one.
+	if(atomic_load(&slot->seq) == pos + 1 || atomic_load(&q->closing)) {
+		atomic_store(&q->sleeping, false);
+		return;
+	}
+
+	struct pollfd pfd = {.fd = q->wake_fd, .events = POLLIN};
+	while(poll(&pfd, 1, -1) < 0 && errno == EINTR)
+		;
+
+	uint64_t count;
+	while(read(q->wake_fd, &count, sizeof count) < 0 && errno == EINTR)
+		;
+}
+
+// Counts a packet not written because the output failed.
+static void count_drop(OutputQueue *q)
+{
+	++q->dropped;
+	stats_count(STATS_DROPPED_WRITES, 1);
+}
+
+// Gives the slot at pos back to the producers.
+static void retire_slot(OutputQueue *q, OutputSlot *slot, const size_t pos)
+{
+	q->latency_ns += to_ns(time_now() - slot->pushed);
+	slot->written = 0;
+	buffer_destroy(&slot->data);
+	arena_reset(&slot->arena);
+	atomic_store_explicit(&q->head, pos + 1, memory_order_relaxed);
+	atomic_store(&slot->seq, pos + OUTPUT_QUEUE_SLOTS);
+
+	if(atomic_load(&q->space_waiters)) {
+		pthread_mutex_lock(&q->space_lock);
+		pthread_cond_broadcast(&q->space);
+		pthread_mutex_unlock(&q->space_lock);
+	}
+}
+
+static void *writer_thread(void *par)
+{
+	OutputQueue *q = par;
+	bool failed = false;
+
+	for(;;) {
+		const size_t pos = atomic_load_explicit(&q->head, memory_order_relaxed);
+		OutputSlot *slot = &q->slots[pos % OUTPUT_QUEUE_SLOTS];
+
+		if(atomic_load_explicit(&slot->seq, memory_order_acquire) != pos + 1) {
+			if(atomic_load(&q->closing)
+				&& atomic_load(&q->tail) == pos)
+			{
+				break;
+			}
+			wait_packet(q, slot, pos);
+			continue;
+		}
+
+		// After a write error, packets are still taken off the
+		// queue, so producers don't wait forever.
+		if(failed || !write_all(q, slot)) {
+			failed = true;
+			count_drop(q);
+		}
+
+		retire_slot(q, slot, pos);
+	}
+
+	return NULL;
+}
+
+// user_data of the poll on wake_fd. Writes use their queue position.
+#define URING_WAKE UINT64_MAX
+
+static bool slot_ready(OutputQueue *q, const size_t pos)
+{
+	return atomic_load_explicit(&q->slots[pos % OUTPUT_QUEUE_SLOTS].seq,
+		memory_order_acquire) == pos + 1;
+}
+
+// Queues a write of what's left of the slot at pos.
+static void prep_write(OutputQueue *q, struct io_uring_sqe *sqe,
+	const size_t pos)
+{
+	const size_t index = pos % OUTPUT_QUEUE_SLOTS;
+	OutputSlot *slot = &q->slots[index];
+	// Slots hold a single link, see output_queue_claim().
+	assert(slot->data.nchunks == 1);
+
+	struct iovec iov;
+	buffer_iovec(&slot->data, &iov, 1, slot->written);
+
+	const struct iovec *reg = &q->registered[index];
+	const uint8_t *base = reg->iov_base;
+	if(base && slot->arena.base == base && (uint8_t *)iov.iov_base >= base
+		&& (uint8_t *)iov.iov_base + iov.iov_len <= base + reg->iov_len)
+	{
+		sqe->opcode = IORING_OP_WRITE_FIXED;
+		sqe->buf_index = index;
+	} else {
+		sqe->opcode = IORING_OP_WRITE;
+	}
+	sqe->fd = q->fd;
+	sqe->addr = (uintptr_t)iov.iov_base;
+	sqe->len = iov.iov_len;
+	// At the file position, for files, as writev() does.
+	sqe->off = (uint64_t)-1;
+	sqe->user_data = pos;
+}
+
+// Non-blocking description of the pipe or device fd is open on, of
+// its own, so the flag doesn't change fd for anyone sharing it, like
+// the shell a stdout pipe comes from. Returns -1 if fd is anything
+// else, or can't be reopened, for writes to block instead: regular
+// files never take long, and sockets can't be reopened.
+static int open_nonblocking(const int fd)
+{
+	struct stat st;
+	if(fstat(fd, &st) < 0 || !(S_ISFIFO(st.st_mode) || S_ISCHR(st.st_mode))) {
+		return -1;
+	}
+	char path[32];
+	snprintf(path, sizeof path, "/proc/self/fd/%d", fd);
+	return open(path, O_WRONLY | O_NONBLOCK | O_CLOEXEC);
+}
+
+// Gives up on io_uring after io_uring_enter() failed for good, and
+// writes everything left with writev(). Bytes the ring wrote already
+// stay counted in the slots.
+static void *uring_fallback(OutputQueue *q)
+{
+	// Closing the ring cancels whatever it was still doing.
+	uring_destroy(&q->ring);
+	memset(q->registered, 0, sizeof q->registered);
+	q->backend = OUTPUT_WRITEV;
+	q->private_fd = open_nonblocking(q->fd);
+	if(q->private_fd >= 0) {
+		q->fd = q->private_fd;
+	}
+	return writer_thread(q);
+}
+
+// Writes queued packets as chains of linked writes, one chain at a
+// time: a chain runs in order, so packets can't overtake each other.
+// A short write cancels the rest of its chain, which is submitted
+// again from where it stopped.
+static void *uring_writer_thread(void *par)
+{
+	OutputQueue *q = par;
+	Uring *r = &q->ring;
+	bool failed = false;
+	bool wake_armed = false;
+	unsigned inflight = 0;
+
+	for(;;) {
+		const size_t head = atomic_load_explicit(&q->head,
+			memory_order_relaxed);
+
+		if(!inflight) {
+			struct io_uring_sqe *last = NULL;
+			for(size_t pos = head; slot_ready(q, pos) && !failed; ++pos) {
+				struct io_uring_sqe *sqe = uring_get_sqe(r);
+				if(!sqe) {
+					break;
+				}
+				prep_write(q, sqe, pos);
+				sqe->flags = IOSQE_IO_LINK;
+				last = sqe;
+				++inflight;
+			}
+			if(last) {
+				last->flags = 0;
+			}
+		}
+
+		if(!inflight && failed && slot_ready(q, head)) {
+			// After a write error, packets are still taken off
+			// the queue, so producers don't wait forever.
+			count_drop(q);
+			retire_slot(q, &q->slots[head % OUTPUT_QUEUE_SLOTS], head);
+			continue;
+		}
+		// With nothing ready, sleeps until a producer wakes the
+		// writer up. Ready packets without a write queued only mean
+		// the SQ is still full of what the kernel didn't take yet.
+		if(!inflight && !slot_ready(q, head)) {
+			if(atomic_load(&q->closing) && atomic_load(&q->tail) == head) {
+				break;
+			}
+
+			atomic_store(&q->sleeping, true);
+			// Checked again after announcing the sleep, as in
+			// wait_packet().
+			if(slot_ready(q, head) || atomic_load(&q->closing)) {
+				atomic_store(&q->sleeping, false);
+				continue;
+			}
+			if(!wake_armed) {
+				struct io_uring_sqe *sqe = uring_get_sqe(r);
+				if(!sqe) {
+					OutputSlot *slot = &q->slots[head % OUTPUT_QUEUE_SLOTS];
+					wait_packet(q, slot, head);
+					continue;
+				}
+				sqe->opcode = IORING_OP_POLL_ADD;
+				sqe->fd = q->wake_fd;
+				sqe->poll32_events = POLLIN;
+				sqe->user_data = URING_WAKE;
+				wake_armed = true;
+			}
+		}
+
+		const double start = time_now();
+		++q->syscalls;
+		const int submitted = uring_submit(r, 1);
+		if(submitted < 0 && errno != EBUSY && errno != EAGAIN) {
+			perror("io_uring_enter failed, writing with writev");
+			return uring_fallback(q);
+		}
+		if(inflight) {
+			q->stall_ns += to_ns(time_now() - start);
+		}
+
+		// EBUSY and EAGAIN leave the SQEs queued, to be submitted
+		// again once completions are reaped, or the kernel has some
+		// memory to spare.
+		bool reaped = false;
+		struct io_uring_cqe *cqe;
+		while((cqe = uring_peek_cqe(r))) {
+			reaped = true;
+			const uint64_t pos = cqe->user_data;
+			const int res = cqe->res;
+			uring_cqe_seen(r);
+
+			if(pos == URING_WAKE) {
+				wake_armed = false;
+				uint64_t count;
+				while(read(q->wake_fd, &count, sizeof count) < 0
+					&& errno == EINTR)
+					;
+				continue;
+			}
+
+			--inflight;
+			OutputSlot *slot = &q->slots[pos % OUTPUT_QUEUE_SLOTS];
+			if(res >= 0) {
+				slot->written += res;
+				if(slot->written < slot->data.total_size) {
+					++q->short_writes;
+				}
+			} else if(res == -EAGAIN) {
+				// fd was non-blocking already.
+				++q->would_block;
+				wait_writable(q);
+			} else if(res != -ECANCELED && !failed) {
+				errno = -res;
+				perror("Failed to write output");
+				failed = true;
+			}
+		}
+		if(submitted < 0 && !reaped) {
+			++q->would_block;
+			nanosleep(&(struct timespec){.tv_nsec = 1000000}, NULL);
+		}
+
+		// Retires what the finished chain wrote in full.
+		if(!inflight) {
+			size_t pos = atomic_load_explicit(&q->head, memory_order_relaxed);
+			for(; slot_ready(q, pos); ++pos) {
+				OutputSlot *slot = &q->slots[pos % OUTPUT_QUEUE_SLOTS];
+				if(slot->written < slot->data.total_size) {
+					if(!failed) {
+						break;
+					}
+					count_drop(q);
+				} else {
+					++q->packets;
+				}
+				q->bytes += slot->written;
+				retire_slot(q, slot, pos);
+			}
+		}
+	}
+
+	return NULL;
+}
+
+// Sets up the ring, with the slot arenas reserved and registered.
+// Returns -1 if io_uring can't be used.
+static int start_uring(OutputQueue *q)
+{
+	// A write per slot, and the poll on wake_fd.
+	if(uring_init(&q->ring, 2 * OUTPUT_QUEUE_SLOTS) < 0) {
+		return -1;
+	}
+
+	for(size_t i = 0; i < OUTPUT_QUEUE_SLOTS; ++i) {
+		Arena *arena = &q->slots[i].arena;
+		arena->demand = OUTPUT_SLOT_RESERVE;
+		arena_reset(arena);
+		q->registered[i].iov_base = arena->base;
+		q->registered[i].iov_len = arena->capacity;
+	}
+	if(uring_register_buffers(&q->ring, q->registered,
+		OUTPUT_QUEUE_SLOTS) < 0)
+	{
+		// Plain writes work all the same.
+		memset(q->registered, 0, sizeof q->registered);
+	}
+	return 0;
+}
+
+// Frees everything but the writer thread.
+static void output_queue_release(OutputQueue *q)
+{
+	if(q->private_fd >= 0) {
+		close(q->private_fd);
+	}
+	close(q->wake_fd);
+	if(q->ring.fd >= 0) {
+		uring_destroy(&q->ring);
+	}
+	for(size_t i = 0; i < OUTPUT_QUEUE_SLOTS; ++i) {
+		arena_free(&q->slots[i].arena);
+	}
+	pthread_cond_destroy(&q->space);
+	pthread_mutex_destroy(&q->space_lock);
+}
+
+int output_queue_start(OutputQueue *q, const int fd,
+	OutputBackend backend)
+{
+	memset(q, 0, sizeof *q);
+	q->ring.fd = -1;
+	for(size_t i = 0; i < OUTPUT_QUEUE_SLOTS; ++i) {
+		atomic_init(&q->slots[i].seq, i);
+	}
+
+	q->wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+	if(q->wake_fd < 0) {
+		perror("Failed to create output queue eventfd");
+		return -1;
+	}
+
+	if(backend == OUTPUT_URING && start_uring(q) < 0) {
+		perror("io_uring unavailable, writing with writev");
+		backend = OUTPUT_WRITEV;
+	}
+	q->backend = backend;
+
+	q->fd = fd;
+	q->private_fd = -1;
+	// io_uring waits for the output itself.
+	if(backend == OUTPUT_WRITEV) {
+		q->private_fd = open_nonblocking(fd);
+		if(q->private_fd >= 0) {
+			q->fd = q->private_fd;
+		}
+	}
+
+	pthread_mutex_init(&q->space_lock, NULL);
+	pthread_cond_init(&q->space, NULL);
+
+	if(pthread_create(&q->writer, NULL, backend == OUTPUT_URING
+		? uring_writer_thread : writer_thread, q) != 0)
+	{
+		fputs("Failed to start output writer thread\n", stderr);
+		output_queue_release(q);
+		return -1;
+	}
+	return 0;
+}
+
+void output_queue_close(OutputQueue *q)
+{
+	atomic_store(&q->closing, true);
+	atomic_store(&q->sleeping, true);
+	wake_writer(q);
+	pthread_join(q->writer, NULL);
+	output_queue_release(q);
+}
+
+void output_queue_stats(OutputQueue *q, OutputStats *stats)
+{
+	stats->backend = q->backend;
+	stats->packets = q->packets;
+	stats->dropped = q->dropped;
+	stats->bytes = q->bytes;
+	stats->short_writes = q->short_writes;
+	stats->would_block = q->would_block;
+	stats->stall_time = q->stall_ns * 1e-9;
+	stats->full_waits = q->full_waits;
+	stats->full_time = q->full_ns * 1e-9;
+	stats->depth = atomic_load(&q->tail) - atomic_load(&q->head);
+	stats->max_depth = q->max_depth;
+	stats->syscalls = q->syscalls;
+	stats->mean_latency = stats->packets
+		? q->latency_ns * 1e-9 / stats->packets : 0.0;
+}
+
+void output_stats_print(const OutputStats *stats, FILE *out)
+{
+	fprintf(out, "Output (%s): %llu packets, %llu bytes, queue depth %zu (max %zu)\n"
+		"  %llu packets dropped after a write error\n"
+		"  %llu short writes, %llu would block, %.3f s stalled\n"
+		"  %llu waits for a full queue, %.3f s waited\n"
+		"  %llu write syscalls, %.1f us from push to written\n",
+		stats->backend == OUTPUT_URING ? "io_uring" : "writev",
+		(unsigned long long)stats->packets,
+		(unsigned long long)stats->bytes,
+		stats->depth, stats->max_depth,
+		(unsigned long long)stats->dropped,
+		(unsigned long long)stats->short_writes,
+		(unsigned long long)stats->would_block, stats->stall_time,
+		(unsigned long long)stats->full_waits, stats->full_time,
+		(unsigned long long)stats->syscalls, stats->mean_latency * 1e6);
+}
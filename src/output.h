@@ -0,0 +1,139 @@
+#pragma once
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <pthread.h>
+
+#include "buffer.h"
+#include "uring.h"
+
+// Packets that may be waiting for the writer at once.
+#define OUTPUT_QUEUE_SLOTS 64
+
+// Arena reserved for each slot with io_uring, registered with the ring
+// so writes skip mapping the pages in. Larger packets still work,
+// through unregistered memory.
+#define OUTPUT_SLOT_RESERVE 65536
+
+// How the writer thread writes the packets.
+enum OutputBackend
+{
+	// writev(), polling a non-blocking fd when it's full.
+	OUTPUT_WRITEV,
+	// Linked chains of io_uring writes, falling back to writev()
+	// where io_uring isn't available.
+	OUTPUT_URING,
+};
+typedef enum OutputBackend OutputBackend;
+
+struct OutputSlot
+{
+	// Queue position this slot is free for, plus one once it's full.
+	atomic_size_t seq;
+	// Memory of data, owned by whoever owns the slot: the producer
+	// that claimed it, then the writer.
+	Arena arena;
+	Buffer data;
+	// Time data was pushed.
+	double pushed;
+	// Bytes of data written so far, with io_uring.
+	size_t written;
+};
+typedef struct OutputSlot OutputSlot;
+
+struct OutputStats
+{
+	OutputBackend backend;
+	uint64_t packets;
+	uint64_t bytes;
+	// Packets not written, once the output failed.
+	uint64_t dropped;
+	// writev() calls that wrote less than asked, or nothing at all
+	// because the output was full.
+	uint64_t short_writes;
+	uint64_t would_block;
+	// Seconds the writer waited for the output to drain.
+	double stall_time;
+	// Times, and seconds, producers waited for a free slot.
+	uint64_t full_waits;
+	double full_time;
+	size_t depth;
+	size_t max_depth;
+	// System calls made to write, and mean seconds from a packet
+	// being pushed to it being written.
+	uint64_t syscalls;
+	double mean_latency;
+};
+typedef struct OutputStats OutputStats;
+
+// Finished packets from any number of producer threads, written in
+// order by a single writer thread. Producers never touch the output,
+// so they never wait for it, unless the queue is full, and then sleep
+// until the writer frees a slot.
+struct OutputQueue
+{
+	OutputSlot slots[OUTPUT_QUEUE_SLOTS];
+	atomic_size_t tail;
+	atomic_size_t head;
+
+	// Written to: the fd given, or private_fd if not -1.
+	int fd;
+	int private_fd;
+	OutputBackend backend;
+	Uring ring;
+	// Slot arenas registered with ring, if not empty.
+	struct iovec registered[OUTPUT_QUEUE_SLOTS];
+	// eventfd waking the writer up when it's asleep.
+	int wake_fd;
+	atomic_bool sleeping;
+	atomic_bool closing;
+	pthread_t writer;
+
+	// Producers waiting for a free slot, woken up through space.
+	atomic_uint space_waiters;
+	pthread_mutex_t space_lock;
+	pthread_cond_t space;
+
+	atomic_uint_fast64_t packets;
+	atomic_uint_fast64_t bytes;
+	atomic_uint_fast64_t dropped;
+	atomic_uint_fast64_t short_writes;
+	atomic_uint_fast64_t would_block;
+	atomic_uint_fast64_t stall_ns;
+	atomic_uint_fast64_t full_waits;
+	atomic_uint_fast64_t full_ns;
+	atomic_size_t max_depth;
+	atomic_uint_fast64_t syscalls;
+	atomic_uint_fast64_t latency_ns;
+};
+typedef struct OutputQueue OutputQueue;
+
+//! Starts the writer thread, writing to fd with backend. fd itself is
+//! left as it is: with OUTPUT_WRITEV, a pipe or device is written
+//! through a non-blocking description of its own, anything else with
+//! blocking writes. Returns -1 on failure.
+int output_queue_start(OutputQueue *q, int fd, OutputBackend backend);
+
+//! Writes everything queued so far and stops the writer thread. fd
+//! stays open.
+void output_queue_close(OutputQueue *q);
+
+//! Claims the slot for the next packet, waiting while the queue is
+//! full, and sets *pos to its queue position. The packet is built in
+//! place, as the slot's data, in a single link of the slot's arena,
+//! which the writer takes over with output_queue_publish(). Packets
+//! are written in the order their slots were claimed.
+OutputSlot *output_queue_claim(OutputQueue *q, size_t *pos);
+
+//! Hands the slot at pos claimed with output_queue_claim() to the
+//! writer.
+void output_queue_publish(OutputQueue *q, OutputSlot *slot, size_t pos);
+
+//! Queues a copy of data, so it may be destroyed right away. The copy
+//! counts in STATS_COPIED_BYTES, as every buffer_read() does.
+void output_queue_push(OutputQueue *q, const Buffer *data);
+
+void output_queue_stats(OutputQueue *q, OutputStats *stats);
+
+void output_stats_print(const OutputStats *stats, FILE *out);
@@ -0,0 +1,101 @@
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "pts.h"
+
+#define TS_PACKET_SIZE 188
+#define TS_SYNC_BYTE 0x47
+
+uint64_t pts_add(const uint64_t origin, const double seconds)
+{
+	return (origin + (uint64_t)llround(seconds * PTS_HZ)) & PTS_MASK;
+}
+
+uint64_t pts_add_ms(const uint64_t origin, const uint64_t ms)
+{
+	return (origin + ms * (PTS_HZ / 1000)) & PTS_MASK;
+}
+
+int64_t pts_diff(const uint64_t a, const uint64_t b)
+{
+	// The shortest way around the 33-bit circle.
+	const uint64_t d = (a - b) & PTS_MASK;
+	return d & (UINT64_C(1) << 32) ? (int64_t)d - (int64_t)(PTS_MASK + 1)
+		: (int64_t)d;
+}
+
+static bool parse_digits(const char *text, const size_t n, unsigned *value)
+{
+	*value = 0;
+	for(size_t i = 0; i < n; ++i) {
+		if(text[i] < '0' || text[i] > '9') {
+			return false;
+		}
+		*value = *value * 10 + (text[i] - '0');
+	}
+	return true;
+}
+
+size_t pts_parse_timecode(const char *text, const size_t size, uint64_t *ms)
+{
+	unsigned h, m, s;
+	if(size < 8 || text[2] != ':' || text[5] != ':'
+		|| !parse_digits(text, 2, &h) || !parse_digits(text + 3, 2, &m)
+		|| !parse_digits(text + 6, 2, &s) || m > 59 || s > 59)
+	{
+		return 0;
+	}
+	size_t i = 8;
+
+	unsigned frac = 0;
+	if(i < size && (text[i] == '.' || text[i] == ',')) {
+		++i;
+		unsigned scale = 100;
+		for(; i < size && scale && text[i] >= '0' && text[i] <= '9'; ++i) {
+			frac += (text[i] - '0') * scale;
+			scale /= 10;
+		}
+	}
+
+	if(i < size) {
+		if(text[i] == ' ' || text[i] == '\t') {
+			++i;
+		} else if(text[i] != '\n' && text[i] != '\r') {
+			return 0;
+		}
+	}
+
+	*ms = ((uint64_t)h * 3600 + m * 60 + s) * 1000 + frac;
+	return i;
+}
+
+int pts_read_pcr(const char *path, uint64_t *base)
+{
+	FILE *f = fopen(path, "rb");
+	if(!f) {
+		perror("Can't open PCR reference");
+		return -1;
+	}
+
+	// From ISO 13818-1, Section 2.4.3.2, Transport Stream packet
+	// layer, and 2.4.3.4, Adaptation field.
+	uint8_t p[TS_PACKET_SIZE];
+	while(fread(p, sizeof p, 1, f) == 1) {
+		if(p[0] != TS_SYNC_BYTE) {
+			break;
+		}
+		// adaptation_field_control with an adaptation field,
+		// adaptation_field_length, PCR_flag
+		if((p[3] & 0x20) && p[4] >= 7 && (p[5] & 0x10)) {
+			*base = (uint64_t)p[6] << 25 | (uint64_t)p[7] << 17
+				| (uint64_t)p[8] << 9 | (uint64_t)p[9] << 1 | p[10] >> 7;
+			fclose(f);
+			return 0;
+		}
+	}
+
+	fprintf(stderr, "No PCR found in '%s'\n", path);
+	fclose(f);
+	return -1;
+}
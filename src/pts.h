@@ -0,0 +1,40 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// PTS counts a 90 kHz clock in 33 bits, wrapping around about every
+// 26.5 hours, ISO 13818-1, Section 2.4.3.7.
+#define PTS_HZ 90000
+#define PTS_MASK ((UINT64_C(1) << 33) - 1)
+
+// Where the PTS of a caption stream comes from.
+enum PTSSource
+{
+	// Time since the first packet was encoded.
+	PTS_WALL_CLOCK,
+	// Timecodes at the start of input lines.
+	PTS_TIMECODE,
+	// Given by the caller for each caption, from cue times.
+	PTS_CUE,
+};
+typedef enum PTSSource PTSSource;
+
+//! PTS seconds after origin, wrapped to 33 bits.
+uint64_t pts_add(uint64_t origin, double seconds);
+
+//! Same, for a whole number of milliseconds, with no rounding at all.
+uint64_t pts_add_ms(uint64_t origin, uint64_t ms);
+
+//! a - b, for PTS that may have wrapped around in between.
+int64_t pts_diff(uint64_t a, uint64_t b);
+
+//! Parses a timecode "HH:MM:SS", optionally followed by '.' or ','
+//! and up to 3 digits of fraction, at the start of text. It must be
+//! followed by a blank, which is taken with it, or by the end of the
+//! line. Returns the length taken, or 0 if there is no timecode.
+size_t pts_parse_timecode(const char *text, size_t size, uint64_t *ms);
+
+//! Base of the first PCR in the MPEG-TS file at path, the video the
+//! captions go with. Returns -1 if there is none.
+int pts_read_pcr(const char *path, uint64_t *base);
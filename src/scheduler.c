@@ -0,0 +1,185 @@
+#define _POSIX_C_SOURCE 200809L
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/timerfd.h>
+
+#include "timer.h"
+
+#include "scheduler.h"
+
+static uint64_t tick_of(const Scheduler *s, const double time)
+{
+	if(time <= s->start) {
+		return 0;
+	}
+	return (uint64_t)((time - s->start) / SCHEDULER_TICK);
+}
+
+int scheduler_init(Scheduler *s, const double now)
+{
+	memset(s, 0, sizeof *s);
+	s->start = now;
+	s->timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+	if(s->timer_fd < 0) {
+		perror("Failed to create scheduler timerfd");
+		return -1;
+	}
+	return 0;
+}
+
+void scheduler_destroy(Scheduler *s)
+{
+	close(s->timer_fd);
+}
+
+void timer_init(Timer *t, void (*fire)(Timer *timer, double now), void *par)
+{
+	memset(t, 0, sizeof *t);
+	t->fire = fire;
+	t->par = par;
+}
+
+static void unlink_timer(Timer *t)
+{
+	if(t->next) {
+		t->next->pprev = t->pprev;
+	}
+	*t->pprev = t->next;
+	t->next = NULL;
+	t->pprev = NULL;
+}
+
+void timer_cancel(Scheduler *s, Timer *t)
+{
+	if(timer_armed(t)) {
+		unlink_timer(t);
+		--s->armed;
+	}
+}
+
+void timer_add(Scheduler *s, Timer *t, const double deadline)
+{
+	timer_cancel(s, t);
+
+	uint64_t tick = tick_of(s, deadline);
+	if(tick < s->tick) {
+		tick = s->tick;
+	}
+
+	Timer **slot = &s->wheel[tick % SCHEDULER_SLOTS];
+	t->deadline = deadline;
+	t->next = *slot;
+	if(t->next) {
+		t->next->pprev = &t->next;
+	}
+	t->pprev = slot;
+	*slot = t;
+	++s->armed;
+}
+
+// Fires the timers in a slot that are due by now. Firing may change
+// the slot, so the scan restarts after every one.
+static void run_slot(Scheduler *s, Timer **slot, const double now)
+{
+	Timer *t = *slot;
+	while(t) {
+		if(t->deadline > now) {
+			t = t->next;
+			continue;
+		}
+		timer_cancel(s, t);
+		t->fire(t, now);
+		t = *slot;
+	}
+}
+
+void scheduler_run(Scheduler *s, const double now)
+{
+	const uint64_t end = tick_of(s, now);
+
+	// A whole turn visits every slot, however late the loop is.
+	uint64_t last = end;
+	if(last - s->tick >= SCHEDULER_SLOTS) {
+		last = s->tick + SCHEDULER_SLOTS - 1;
+	}
+
+	for(uint64_t tick = s->tick; tick <= last; ++tick) {
+		run_slot(s, &s->wheel[tick % SCHEDULER_SLOTS], now);
+	}
+
+	// The current tick may still get timers due later in it.
+	if(end > s->tick) {
+		s->tick = end;
+	}
+}
+
+// Earliest deadline of all timers, INFINITY if none.
+static double next_deadline(const Scheduler *s)
+{
+	double first = INFINITY;
+	if(!s->armed) {
+		return first;
+	}
+
+	for(uint64_t i = 0; i < SCHEDULER_SLOTS; ++i) {
+		const uint64_t tick = s->tick + i;
+		for(Timer *t = s->wheel[tick % SCHEDULER_SLOTS]; t; t = t->next) {
+			if(t->deadline < first) {
+				first = t->deadline;
+			}
+		}
+
+		// Nothing in later slots can be due before the end of this
+		// tick, unless it's a turn or more away.
+		if(first < s->start + (tick + 1) * SCHEDULER_TICK) {
+			break;
+		}
+	}
+	return first;
+}
+
+void scheduler_arm(Scheduler *s)
+{
+	struct itimerspec spec = {0};
+
+	// A virtual clock is skipped ahead instead, by scheduler_skip().
+	const double first = clock_mode() == CLOCK_MODE_VIRTUAL
+		? INFINITY : next_deadline(s);
+	if(!isinf(first)) {
+		// Deadlines are on time_now()'s clock, so the timer is
+		// set relative to it. Zero would disarm the timer.
+		double wait = clock_real_duration(first - time_now());
+		if(wait < 1e-9) {
+			wait = 1e-9;
+		}
+		double secs;
+		spec.it_value.tv_nsec = (long)(modf(wait, &secs) * 1e9);
+		spec.it_value.tv_sec = (time_t)secs;
+		if(!spec.it_value.tv_sec && !spec.it_value.tv_nsec) {
+			spec.it_value.tv_nsec = 1;
+		}
+	}
+
+	timerfd_settime(s->timer_fd, 0, &spec, NULL);
+}
+
+bool scheduler_skip(Scheduler *s)
+{
+	const double first = next_deadline(s);
+	if(isinf(first)) {
+		return false;
+	}
+	clock_skip_to(first);
+	return true;
+}
+
+void scheduler_ack(Scheduler *s)
+{
+	uint64_t expirations;
+	while(read(s->timer_fd, &expirations, sizeof expirations) < 0
+		&& errno == EINTR)
+		;
+}
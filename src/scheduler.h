@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Timer wheel granularity, in seconds, and number of slots. Timers
+// further away than a whole turn wait in their slot for later turns.
+#define SCHEDULER_TICK 0.001
+#define SCHEDULER_SLOTS 1024
+
+struct Timer
+{
+	struct Timer *next;
+	struct Timer **pprev;
+	double deadline;
+	void (*fire)(struct Timer *timer, double now);
+	void *par;
+};
+typedef struct Timer Timer;
+
+// Timers of an event loop, on a hashed timer wheel. The loop waits on
+// the scheduler timerfd, armed for the earliest deadline.
+struct Scheduler
+{
+	int timer_fd;
+	double start;
+	// Next tick to be fired.
+	uint64_t tick;
+	size_t armed;
+	Timer *wheel[SCHEDULER_SLOTS];
+};
+typedef struct Scheduler Scheduler;
+
+//! Returns -1 on failure.
+int scheduler_init(Scheduler *s, double now);
+void scheduler_destroy(Scheduler *s);
+
+void timer_init(Timer *t, void (*fire)(Timer *timer, double now), void *par);
+
+//! (Re)schedules t to fire at deadline, or as soon as possible if
+//! deadline is already past.
+void timer_add(Scheduler *s, Timer *t, double deadline);
+void timer_cancel(Scheduler *s, Timer *t);
+
+static inline bool timer_armed(const Timer *t)
+{
+	return t->pprev != NULL;
+}
+
+//! Fires every timer due by now. Timers may be added or canceled
+//! from within fire().
+void scheduler_run(Scheduler *s, double now);
+
+//! Sets the timerfd to expire at the earliest deadline, if any.
+void scheduler_arm(Scheduler *s);
+
+//! With a virtual clock, moves it to the earliest deadline, once no
+//! input can come before it. Returns false if no timer is armed.
+bool scheduler_skip(Scheduler *s);
+
+//! Consumes the expirations of the timerfd after it polled readable.
+void scheduler_ack(Scheduler *s);
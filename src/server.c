@@ -0,0 +1,405 @@
+#define _POSIX_C_SOURCE 200809L
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+
+#include "stats.h"
+#include "timer.h"
+
+#include "server.h"
+
+#define MAX_EVENTS 64
+
+// epoll data of the scheduler timerfd. Streams use their index.
+#define TIMER_EVENT UINT64_MAX
+
+struct Server
+{
+	ServerStream *streams;
+	size_t nstreams;
+	Scheduler sched;
+	Timer publish;
+	int epfd;
+	size_t active;
+	bool debug;
+};
+typedef struct Server Server;
+
+// According to ARIB TR-B14, Fascicle 2, Section 4.2.2, minimum
+// interval between PES packets is 100 ms. This is the earliest time
+// the next one of s may be sent.
+static double next_slot(const ServerStream *s)
+{
+	return s->last_time + PES_MIN_INTERVAL;
+}
+
+// Queues the first PES packet in pes. TS packets are built straight
+// into the queue slot, which the writer then owns, so handing one over
+// includes packetizing it. A PES packet references the stream arena,
+// reset as soon as its caption is sent, and is copied into the slot.
+static void queue_packet(ServerStream *s, Buffer *pes)
+{
+	if(!s->cs.config.ts_output) {
+		Buffer wire;
+		caption_next_packet(&s->cs, &s->arena, pes, &wire);
+		stats_count(STATS_BYTES, buffer_get_size(&wire));
+
+		const uint64_t start = stats_start();
+		output_queue_push(s->queue, &wire);
+		stats_stop(STATS_WRITE, start);
+		buffer_destroy(&wire);
+		return;
+	}
+
+	const uint64_t start = stats_start();
+	size_t pos;
+	OutputSlot *slot = output_queue_claim(s->queue, &pos);
+	caption_next_packet(&s->cs, &slot->arena, pes, &slot->data);
+	stats_count(STATS_BYTES, buffer_get_size(&slot->data));
+	output_queue_publish(s->queue, slot, pos);
+	stats_stop(STATS_WRITE, start);
+}
+
+// Writes the first PES packet in pes.
+static void write_packet(ServerStream *s, Buffer *pes)
+{
+	if(s->queue) {
+		queue_packet(s, pes);
+		return;
+	}
+
+	Buffer wire;
+	caption_next_packet(&s->cs, &s->arena, pes, &wire);
+	stats_count(STATS_BYTES, buffer_get_size(&wire));
+
+	const uint64_t start = stats_start();
+	if(s->udp) {
+		if(udp_output_send(s->udp, &wire) < 0) {
+			stats_count(STATS_DROPPED_WRITES, 1);
+		}
+	} else if(buffer_write(&wire, s->out) < 0) {
+		stats_count(STATS_DROPPED_WRITES, 1);
+	}
+	stats_stop(STATS_WRITE, start);
+	buffer_destroy(&wire);
+}
+
+static void set_paused(ServerStream *s, const bool paused)
+{
+	s->paused = paused;
+	// Taken out of the epoll set rather than left with no events, as
+	// a pipe closed at the other end would still report EPOLLHUP.
+	if(s->polled && !s->reader.eof) {
+		struct epoll_event ev = {
+			.events = EPOLLIN,
+			.data.u64 = s - s->server->streams,
+		};
+		epoll_ctl(s->server->epfd, paused ? EPOLL_CTL_DEL : EPOLL_CTL_ADD,
+			s->in_fd, &ev);
+	}
+}
+
+static void queue_caption(ServerStream *s, Buffer *pes, const double now)
+{
+	QueuedCaption *c = &s->queued[(s->queued_head + s->queued_count)
+		% SERVER_CAPTION_QUEUE];
+	c->arrival = now;
+	c->size = buffer_get_size(pes);
+	c->started = false;
+	++s->queued_count;
+
+	buffer_concat(&s->pending, pes);
+	if(!timer_armed(&s->release)) {
+		const double slot = next_slot(s);
+		timer_add(&s->server->sched, &s->release, slot > now ? slot : now);
+	}
+}
+
+// Queues the captions completed by the lines read so far, until the
+// queue is full.
+static void split_lines(ServerStream *s, const double now)
+{
+	LineView line;
+	while(!s->paused && line_reader_next(&s->reader, &line)) {
+		Buffer pes;
+		if(caption_push_line(&s->cs, &s->arena, line.data, line.size, &pes)) {
+			if(s->server->debug) {
+				fprintf(stderr, "Sending subtitle:\n%s\n", s->cs.text);
+			}
+			queue_caption(s, &pes, now);
+			if(s->queued_count == SERVER_CAPTION_QUEUE) {
+				set_paused(s, true);
+			}
+		}
+	}
+}
+
+static void read_input(ServerStream *s, const double now)
+{
+	// Without polling, read a single block at a time.
+	for(bool more = true; more && !s->paused && !s->reader.eof;
+		more = s->polled)
+	{
+		const uint64_t start = stats_start();
+		const ssize_t n = line_reader_fill(&s->reader);
+		stats_stop(STATS_READ, start);
+		if(n < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			if(errno == EAGAIN || errno == EWOULDBLOCK) {
+				return;
+			}
+			perror("Error reading caption input");
+		}
+
+		if(s->reader.eof && s->polled) {
+			epoll_ctl(s->server->epfd, EPOLL_CTL_DEL, s->in_fd, NULL);
+		}
+		split_lines(s, now);
+	}
+}
+
+// Reads what the stream can take, and retires it once its input
+// is over and everything has been sent.
+static void feed(ServerStream *s, const double now)
+{
+	// Regular files are always readable, so they are read only
+	// while the stream has nothing to send.
+	while(!s->polled && !s->reader.eof && !s->paused && !s->queued_count) {
+		read_input(s, now);
+	}
+
+	if(s->reader.eof && !line_reader_pending(&s->reader)
+		&& !s->queued_count && !s->done)
+	{
+		Server *server = s->server;
+		timer_cancel(&server->sched, &s->management);
+		timer_cancel(&server->sched, &s->release);
+		if(!s->queue && !s->udp) {
+			fflush(s->out);
+		}
+		s->done = true;
+		--server->active;
+	}
+}
+
+static void management_fire(Timer *t, const double now)
+{
+	ServerStream *s = t->par;
+	if(now < next_slot(s)) {
+		timer_add(&s->server->sched, t, next_slot(s));
+		return;
+	}
+
+	Buffer data;
+	caption_management(&s->cs, &s->arena, &data);
+	while(buffer_get_size(&data)) {
+		write_packet(s, &data);
+	}
+	buffer_destroy(&data);
+	s->last_time = now;
+
+	if(!buffer_get_size(&s->pending)) {
+		arena_reset(&s->arena);
+	}
+	timer_add(&s->server->sched, t, now + CAPTION_MANAGEMENT_INTERVAL);
+}
+
+static void release_fire(Timer *t, const double now)
+{
+	ServerStream *s = t->par;
+	Server *server = s->server;
+	if(now < next_slot(s)) {
+		timer_add(&server->sched, t, next_slot(s));
+		return;
+	}
+
+	QueuedCaption *c = &s->queued[s->queued_head];
+	if(!c->started) {
+		const double delay = now - c->arrival;
+		if(server->debug) {
+			fprintf(stderr, "Caption queued for %.1f ms\n", delay * 1e3);
+		}
+		++s->captions;
+		s->total_delay += delay;
+		if(stats_enabled) {
+			stats_record(STATS_QUEUE, delay * 1e9);
+		}
+		if(delay > s->max_delay) {
+			s->max_delay = delay;
+		}
+		c->started = true;
+	}
+
+	const size_t before = buffer_get_size(&s->pending);
+	write_packet(s, &s->pending);
+	s->last_time = now;
+
+	c->size -= before - buffer_get_size(&s->pending);
+	if(!c->size) {
+		s->queued_head = (s->queued_head + 1) % SERVER_CAPTION_QUEUE;
+		--s->queued_count;
+	}
+
+	if(buffer_get_size(&s->pending)) {
+		timer_add(&server->sched, t, next_slot(s));
+		return;
+	}
+
+	// Nothing in the arena is referenced anymore.
+	buffer_destroy(&s->pending);
+	arena_reset(&s->arena);
+
+	if(s->paused) {
+		set_paused(s, false);
+		split_lines(s, now);
+		read_input(s, now);
+	}
+	feed(s, now);
+}
+
+static void publish_fire(Timer *t, const double now)
+{
+	Server *server = t->par;
+	stats_publish();
+	timer_add(&server->sched, t, now + STATS_PUBLISH_INTERVAL);
+}
+
+// Whether a polled input may still bring lines before the next
+// deadline. Paused inputs wait for time to pass, so they don't count.
+static bool awaiting_input(const Server *server)
+{
+	for(size_t i = 0; i < server->nstreams; ++i) {
+		const ServerStream *s = &server->streams[i];
+		if(s->polled && !s->reader.eof && !s->paused) {
+			return true;
+		}
+	}
+	return false;
+}
+
+int server_run(ServerStream *streams, size_t nstreams, bool debug)
+{
+	Server server = {
+		.active = nstreams,
+		.debug = debug,
+		.streams = streams,
+		.nstreams = nstreams,
+	};
+
+	server.epfd = epoll_create1(0);
+	if(server.epfd < 0) {
+		perror("Failed to create epoll instance");
+		return -1;
+	}
+
+	const double start = time_now();
+	if(scheduler_init(&server.sched, start) < 0) {
+		close(server.epfd);
+		return -1;
+	}
+
+	int ret = 0;
+	struct epoll_event tev = {.events = EPOLLIN, .data.u64 = TIMER_EVENT};
+	if(epoll_ctl(server.epfd, EPOLL_CTL_ADD, server.sched.timer_fd, &tev) < 0) {
+		perror("Failed to watch scheduler timer");
+		ret = -1;
+		goto out;
+	}
+
+	for(size_t i = 0; i < nstreams; ++i) {
+		ServerStream *s = &streams[i];
+		s->server = &server;
+		s->cs.config.keep_text = debug;
+		line_reader_init(&s->reader, s->in_fd, CAPTION_MAX_TEXT);
+		timer_init(&s->management, management_fire, s);
+		timer_init(&s->release, release_fire, s);
+		fcntl(s->in_fd, F_SETFL, fcntl(s->in_fd, F_GETFL) | O_NONBLOCK);
+
+		struct epoll_event ev = {.events = EPOLLIN, .data.u64 = i};
+		if(epoll_ctl(server.epfd, EPOLL_CTL_ADD, s->in_fd, &ev) == 0) {
+			s->polled = true;
+		} else if(errno != EPERM) {
+			perror("Failed to watch caption input");
+			ret = -1;
+			goto out;
+		}
+		timer_add(&server.sched, &s->management, start);
+	}
+
+	if(stats_enabled) {
+		timer_init(&server.publish, publish_fire, &server);
+		timer_add(&server.sched, &server.publish, start);
+	}
+
+	scheduler_run(&server.sched, start);
+	for(size_t i = 0; i < nstreams; ++i) {
+		feed(&streams[i], start);
+	}
+
+	while(server.active) {
+		scheduler_arm(&server.sched);
+
+		// With a virtual clock, time passes only once no input can
+		// bring anything more: the loop blocks on input until every
+		// one is at its end or paused, then skips to the next
+		// deadline, so the output doesn't depend on how fast input
+		// comes.
+		const bool virtual = clock_mode() == CLOCK_MODE_VIRTUAL
+			&& server.sched.armed && !awaiting_input(&server);
+
+		struct epoll_event events[MAX_EVENTS];
+		const int n = epoll_wait(server.epfd, events, MAX_EVENTS,
+			virtual ? 0 : -1);
+		stats_poll_signal();
+		if(n == 0 && virtual) {
+			scheduler_skip(&server.sched);
+		}
+		if(n < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			perror("epoll_wait failed");
+			ret = -1;
+			break;
+		}
+
+		const double now = time_now();
+		for(int i = 0; i < n; ++i) {
+			if(events[i].data.u64 == TIMER_EVENT) {
+				scheduler_ack(&server.sched);
+				continue;
+			}
+			ServerStream *s = &streams[events[i].data.u64];
+			read_input(s, now);
+			feed(s, now);
+		}
+		scheduler_run(&server.sched, now);
+	}
+
+	if(debug) {
+		for(size_t i = 0; i < nstreams; ++i) {
+			const ServerStream *s = &streams[i];
+			if(!s->captions) {
+				continue;
+			}
+			fprintf(stderr, "Stream %zu: %llu captions, queueing delay "
+				"mean %.1f ms, max %.1f ms\n", i,
+				(unsigned long long)s->captions,
+				s->total_delay / s->captions * 1e3, s->max_delay * 1e3);
+		}
+	}
+
+out:
+	for(size_t i = 0; i < nstreams; ++i) {
+		line_reader_destroy(&streams[i].reader);
+		arena_free(&streams[i].arena);
+	}
+	scheduler_destroy(&server.sched);
+	close(server.epfd);
+	return ret;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "buffer.h"
+#include "caption.h"
+#include "line-reader.h"
+#include "output.h"
+#include "scheduler.h"
+#include "udp-output.h"
+
+// Most captions waiting for their PES packets to be sent. When the
+// queue fills up, input is not read until it has drained.
+#define SERVER_CAPTION_QUEUE 64
+
+// A caption waiting in the queue of a stream.
+struct QueuedCaption
+{
+	double arrival;
+	// PES bytes not yet sent.
+	size_t size;
+	bool started;
+};
+typedef struct QueuedCaption QueuedCaption;
+
+// A caption stream served by server_run(), reading caption lines from
+// in_fd and writing the encoded stream to out, or to queue or udp if
+// not NULL.
+struct ServerStream
+{
+	CaptionStream cs;
+	int in_fd;
+	FILE *out;
+	OutputQueue *queue;
+	UdpOutput *udp;
+
+	// Private to server_run():
+	struct Server *server;
+
+	// Memory of the packets of this stream not yet written.
+	Arena arena;
+
+	LineReader reader;
+
+	// Regular files can't be polled, they are read whenever
+	// the stream has nothing left to send.
+	bool polled;
+	// Input is not being read until the queue drains.
+	bool paused;
+
+	// PES packets waiting for their minimum interval.
+	Buffer pending;
+	QueuedCaption queued[SERVER_CAPTION_QUEUE];
+	size_t queued_head;
+	size_t queued_count;
+
+	double last_time;
+	Timer management;
+	Timer release;
+
+	// Time from a caption being read to its first packet going out.
+	uint64_t captions;
+	double total_delay;
+	double max_delay;
+
+	bool done;
+};
+typedef struct ServerStream ServerStream;
+
+//! Serves all the streams from a single thread, until all inputs end.
+int server_run(ServerStream *streams, size_t nstreams, bool debug);
@@ -0,0 +1,254 @@
+#define _POSIX_C_SOURCE 199309L
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "buffer.h"
+
+#include "stats.h"
+
+// Counts of values by magnitude, updated from any thread.
+struct StatsHistogram
+{
+	atomic_uint_fast64_t buckets[STATS_BUCKETS];
+	atomic_uint_fast64_t count;
+	atomic_uint_fast64_t sum;
+	atomic_uint_fast64_t max;
+};
+typedef struct StatsHistogram StatsHistogram;
+
+static const char *const stage_names[STATS_STAGES] = {
+	[STATS_READ] = "read",
+	[STATS_CHARSET] = "charset",
+	[STATS_ENCODE] = "encode",
+	[STATS_CRC] = "crc",
+	[STATS_QUEUE] = "queue",
+	[STATS_WRITE] = "write",
+};
+
+static const char *const counter_names[STATS_COUNTERS] = {
+	[STATS_CAPTIONS] = "captions",
+	[STATS_BYTES] = "bytes",
+	[STATS_PADDING] = "padded_captions",
+	[STATS_WRITE_STALLS] = "write_stalls",
+	[STATS_DROPPED_WRITES] = "dropped_writes",
+	[STATS_COPIED_BYTES] = "copied_bytes",
+};
+
+static const char *const counter_help[STATS_COUNTERS] = {
+	[STATS_CAPTIONS] = "Caption statements encoded.",
+	[STATS_BYTES] = "Bytes handed to the output.",
+	[STATS_PADDING] = "Captions padded to keep their CRC in one TS packet.",
+	[STATS_WRITE_STALLS] = "Times the output was full and writing waited.",
+	[STATS_DROPPED_WRITES] = "Packets not written because the output failed.",
+	[STATS_COPIED_BYTES] = "Bytes copied between buffers on the way to the output.",
+};
+
+bool stats_enabled;
+
+static StatsHistogram stages[STATS_STAGES];
+static atomic_uint_fast64_t counters[STATS_COUNTERS];
+static const char *publish_path;
+static volatile sig_atomic_t dump_requested;
+
+void stats_enable(const char *path)
+{
+	stats_enabled = true;
+	publish_path = path;
+}
+
+uint64_t stats_clock(void)
+{
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (uint64_t)t.tv_sec * 1000000000 + t.tv_nsec;
+}
+
+// Values below 1 << STATS_SUB_BITS have a bucket each. Above, every
+// power of two is split in 1 << STATS_SUB_BITS buckets.
+static unsigned bucket_of(const uint64_t v)
+{
+	if(v < (1u << STATS_SUB_BITS)) {
+		return v;
+	}
+	const unsigned e = 63 - __builtin_clzll(v);
+	const unsigned sub = (v >> (e - STATS_SUB_BITS))
+		& ((1u << STATS_SUB_BITS) - 1);
+	return ((e - STATS_SUB_BITS + 1) << STATS_SUB_BITS) + sub;
+}
+
+// Highest value counted in bucket b.
+static uint64_t bucket_top(const unsigned b)
+{
+	if(b < (1u << STATS_SUB_BITS)) {
+		return b;
+	}
+	const unsigned e = (b >> STATS_SUB_BITS) + STATS_SUB_BITS - 1;
+	const uint64_t sub = b & ((1u << STATS_SUB_BITS) - 1);
+	const uint64_t low = ((1u << STATS_SUB_BITS) + sub) << (e - STATS_SUB_BITS);
+	return low + ((UINT64_C(1) << (e - STATS_SUB_BITS)) - 1);
+}
+
+void stats_record(const StatsStage stage, const uint64_t ns)
+{
+	StatsHistogram *h = &stages[stage];
+	atomic_fetch_add_explicit(&h->buckets[bucket_of(ns)], 1,
+		memory_order_relaxed);
+	atomic_fetch_add_explicit(&h->count, 1, memory_order_relaxed);
+	atomic_fetch_add_explicit(&h->sum, ns, memory_order_relaxed);
+
+	uint_fast64_t max = atomic_load_explicit(&h->max, memory_order_relaxed);
+	while(ns > max && !atomic_compare_exchange_weak_explicit(&h->max,
+		&max, ns, memory_order_relaxed, memory_order_relaxed))
+		;
+}
+
+void stats_count(const StatsCounter counter, const uint64_t n)
+{
+	atomic_fetch_add_explicit(&counters[counter], n, memory_order_relaxed);
+}
+
+uint64_t stats_counter(const StatsCounter counter)
+{
+	return atomic_load_explicit(&counters[counter], memory_order_relaxed);
+}
+
+// Value at or below which fraction q of the values in h fall, to
+// the precision of the buckets.
+static uint64_t quantile(const StatsHistogram *h, const uint64_t count,
+	const double q)
+{
+	uint64_t rank = q * count + 0.5;
+	if(rank < 1) {
+		rank = 1;
+	}
+
+	uint64_t seen = 0;
+	for(unsigned b = 0; b < STATS_BUCKETS; ++b) {
+		seen += atomic_load_explicit(&h->buckets[b], memory_order_relaxed);
+		if(seen >= rank) {
+			const uint64_t top = bucket_top(b);
+			const uint64_t max = atomic_load(&h->max);
+			return top < max ? top : max;
+		}
+	}
+	return atomic_load(&h->max);
+}
+
+static const double quantiles[] = {0.5, 0.9, 0.99, 0.999};
+#define NQUANTILES (sizeof quantiles / sizeof quantiles[0])
+
+void stats_dump(FILE *out)
+{
+	fprintf(out, "%-8s %10s %10s %10s %10s %10s %10s %10s\n", "stage",
+		"count", "mean us", "p50 us", "p90 us", "p99 us", "p99.9 us",
+		"max us");
+	for(unsigned s = 0; s < STATS_STAGES; ++s) {
+		const StatsHistogram *h = &stages[s];
+		const uint64_t count = atomic_load(&h->count);
+		if(!count) {
+			continue;
+		}
+		fprintf(out, "%-8s %10llu %10.1f", stage_names[s],
+			(unsigned long long)count,
+			atomic_load(&h->sum) * 1e-3 / count);
+		for(size_t i = 0; i < NQUANTILES; ++i) {
+			fprintf(out, " %10.1f", quantile(h, count, quantiles[i]) * 1e-3);
+		}
+		fprintf(out, " %10.1f\n", atomic_load(&h->max) * 1e-3);
+	}
+
+	for(unsigned c = 0; c < STATS_COUNTERS; ++c) {
+		fprintf(out, "%s: %llu\n", counter_names[c],
+			(unsigned long long)atomic_load(&counters[c]));
+	}
+	fprintf(out, "allocations: %zu\n", buffer_allocations());
+}
+
+void stats_write_prometheus(FILE *out)
+{
+	fputs("# HELP arib_write_stage_seconds Time spent in each stage "
+		"of the caption pipeline.\n"
+		"# TYPE arib_write_stage_seconds summary\n", out);
+	for(unsigned s = 0; s < STATS_STAGES; ++s) {
+		const StatsHistogram *h = &stages[s];
+		const uint64_t count = atomic_load(&h->count);
+		for(size_t i = 0; i < NQUANTILES && count; ++i) {
+			fprintf(out, "arib_write_stage_seconds{stage=\"%s\","
+				"quantile=\"%g\"} %.9f\n", stage_names[s], quantiles[i],
+				quantile(h, count, quantiles[i]) * 1e-9);
+		}
+		fprintf(out, "arib_write_stage_seconds_sum{stage=\"%s\"} %.9f\n",
+			stage_names[s], atomic_load(&h->sum) * 1e-9);
+		fprintf(out, "arib_write_stage_seconds_count{stage=\"%s\"} %llu\n",
+			stage_names[s], (unsigned long long)count);
+	}
+
+	for(unsigned c = 0; c < STATS_COUNTERS; ++c) {
+		fprintf(out, "# HELP arib_write_%s_total %s\n"
+			"# TYPE arib_write_%s_total counter\n"
+			"arib_write_%s_total %llu\n",
+			counter_names[c], counter_help[c], counter_names[c],
+			counter_names[c], (unsigned long long)atomic_load(&counters[c]));
+	}
+	fprintf(out, "# HELP arib_write_allocations_total Heap allocations "
+		"of packet buffers.\n"
+		"# TYPE arib_write_allocations_total counter\n"
+		"arib_write_allocations_total %zu\n", buffer_allocations());
+}
+
+int stats_publish(void)
+{
+	if(!publish_path) {
+		return 0;
+	}
+
+	// Written aside and renamed over, so scrapers never see half
+	// a file.
+	char *tmp = malloc(strlen(publish_path) + 5);
+	sprintf(tmp, "%s.tmp", publish_path);
+
+	int ret = 0;
+	FILE *out = fopen(tmp, "w");
+	if(!out) {
+		perror("Failed to write stats");
+		ret = -1;
+	} else {
+		stats_write_prometheus(out);
+		if(fclose(out) != 0 || rename(tmp, publish_path) != 0) {
+			perror("Failed to write stats");
+			ret = -1;
+		}
+	}
+	free(tmp);
+	return ret;
+}
+
+static void on_sigusr1(int sig)
+{
+	(void)sig;
+	dump_requested = 1;
+}
+
+void stats_catch_signal(void)
+{
+	// No SA_RESTART, so a wait is interrupted to dump right away.
+	struct sigaction sa;
+	memset(&sa, 0, sizeof sa);
+	sa.sa_handler = on_sigusr1;
+	sigemptyset(&sa.sa_mask);
+	sigaction(SIGUSR1, &sa, NULL);
+}
+
+bool stats_poll_signal(void)
+{
+	if(!dump_requested) {
+		return false;
+	}
+	dump_requested = 0;
+	stats_dump(stderr);
+	stats_publish();
+	return true;
+}
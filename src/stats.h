@@ -0,0 +1,97 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Sub-buckets per power of two in a histogram, as a power of two:
+// values are kept to 1/8 of their magnitude, like HDR histograms.
+#define STATS_SUB_BITS 3
+#define STATS_BUCKETS ((64 - STATS_SUB_BITS + 1) << STATS_SUB_BITS)
+
+// Seconds between rewrites of the stats file while serving.
+#define STATS_PUBLISH_INTERVAL 1.0
+
+// Stages of the caption pipeline, from a line being read to its
+// packets being written, timed in nanoseconds.
+enum StatsStage
+{
+	// Reading a block of input lines.
+	STATS_READ,
+	// Converting a line to the ARIB character set.
+	STATS_CHARSET,
+	// Encoding a caption statement into PES packets, CRC included.
+	STATS_ENCODE,
+	STATS_CRC,
+	// Caption waiting for the minimum PES interval to be sent.
+	STATS_QUEUE,
+	// Handing a packet to the output.
+	STATS_WRITE,
+	STATS_STAGES,
+};
+typedef enum StatsStage StatsStage;
+
+enum StatsCounter
+{
+	STATS_CAPTIONS,
+	STATS_BYTES,
+	// Captions padded so an external TS packetizer can't split
+	// their CRC.
+	STATS_PADDING,
+	// Times output was full and the writer had to wait.
+	STATS_WRITE_STALLS,
+	// Packets not written because the output failed.
+	STATS_DROPPED_WRITES,
+	// Bytes of packets copied in memory, from one buffer to another,
+	// on the way from input to output.
+	STATS_COPIED_BYTES,
+	STATS_COUNTERS,
+};
+typedef enum StatsCounter StatsCounter;
+
+// Timing of stages is only taken once enabled, so it costs a branch
+// otherwise.
+extern bool stats_enabled;
+
+//! Enables timing. If path isn't NULL, stats_publish() writes the
+//! stats there in Prometheus text format.
+void stats_enable(const char *path);
+
+//! Nanoseconds of a monotonic clock.
+uint64_t stats_clock(void);
+
+void stats_record(StatsStage stage, uint64_t ns);
+void stats_count(StatsCounter counter, uint64_t n);
+
+//! Current value of a counter. Counters count whether timing is
+//! enabled or not.
+uint64_t stats_counter(StatsCounter counter);
+
+//! Start of a stage, to be passed to stats_stop().
+static inline uint64_t stats_start(void)
+{
+	return stats_enabled ? stats_clock() : 0;
+}
+
+static inline void stats_stop(StatsStage stage, uint64_t start)
+{
+	if(stats_enabled) {
+		stats_record(stage, stats_clock() - start);
+	}
+}
+
+//! Prints percentiles of every stage and the counters, for people.
+void stats_dump(FILE *out);
+
+//! Writes everything in Prometheus text format.
+void stats_write_prometheus(FILE *out);
+
+//! Replaces the stats file given to stats_enable(), if any, at once.
+int stats_publish(void);
+
+//! Makes SIGUSR1 request a dump.
+void stats_catch_signal(void);
+
+//! Dumps to stderr and publishes, if SIGUSR1 was caught since the
+//! last call. Returns whether it was.
+bool stats_poll_signal(void);
@@ -1,10 +1,20 @@
 #define _POSIX_C_SOURCE 199309L
+#include <assert.h>
+#include <stdatomic.h>
 #include <time.h>
 #include <math.h>
 
 #include "timer.h"
 
-double time_now()
+static ClockMode mode = CLOCK_MODE_REAL;
+static double scale = 1.0;
+// Real time scaling started at.
+static double scaled_base;
+// Virtual time. Any thread may read it, while one advances it. It's
+// kept in seconds, so skipping to a deadline reaches it exactly.
+static _Atomic double virtual_now = CLOCK_VIRTUAL_START;
+
+static double real_now(void)
 {
 	struct timespec t;
 	clock_gettime(CLOCK_MONOTONIC_RAW, &t);
@@ -12,7 +22,59 @@ double time_now()
 	return t.tv_sec + (1e-9 * t.tv_nsec);
 }
 
+void clock_select(const ClockMode m, const double s)
+{
+	assert(m != CLOCK_MODE_SCALED || s > 0.0);
+	mode = m;
+	scale = m == CLOCK_MODE_SCALED ? s : 1.0;
+	scaled_base = real_now();
+}
+
+ClockMode clock_mode(void)
+{
+	return mode;
+}
+
+void clock_skip_to(const double time)
+{
+	assert(mode == CLOCK_MODE_VIRTUAL);
+	double now = atomic_load(&virtual_now);
+	while(time > now && !atomic_compare_exchange_weak(&virtual_now,
+		&now, time))
+		;
+}
+
+double clock_real_duration(const double duration)
+{
+	return mode == CLOCK_MODE_VIRTUAL ? 0.0 : duration / scale;
+}
+
+double time_now()
+{
+	switch(mode) {
+	case CLOCK_MODE_VIRTUAL:
+		return atomic_load(&virtual_now);
+	case CLOCK_MODE_SCALED:
+		// Relative to the base, so seconds keep their precision.
+		return scaled_base + (real_now() - scaled_base) * scale;
+	default:
+		return real_now();
+	}
+}
+
 void sleep_for(const double duration)
+{
+	if(mode == CLOCK_MODE_VIRTUAL) {
+		double now = atomic_load(&virtual_now);
+		while(duration > 0.0 && !atomic_compare_exchange_weak(
+			&virtual_now, &now, now + duration))
+			;
+		return;
+	}
+	sleep_real(clock_real_duration(duration));
+}
+
+void sleep_real(const double duration)
 {
 	struct timespec req;
 	struct timespec rem;
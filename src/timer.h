@@ -1,4 +1,38 @@
 #pragma once
 
+#include <stdbool.h>
+
+// Clock behind time_now() and sleep_for().
+enum ClockMode
+{
+	// The monotonic clock of the system.
+	CLOCK_MODE_REAL,
+	// Only moves when slept on, or skipped ahead by an event loop
+	// with nothing else to do, so runs take no real time at all and
+	// give the same timestamps every time.
+	CLOCK_MODE_VIRTUAL,
+	// The system clock, sped up by a factor.
+	CLOCK_MODE_SCALED,
+};
+typedef enum ClockMode ClockMode;
+
+// Time the virtual clock starts at. Not zero, which callers of
+// time_now() may take as a time not set yet.
+#define CLOCK_VIRTUAL_START 1.0
+
+//! Selects the clock, before any time is taken. scale is how many
+//! times faster than real time CLOCK_MODE_SCALED runs.
+void clock_select(ClockMode mode, double scale);
+ClockMode clock_mode(void);
+
+//! Moves the virtual clock to time, if it's later.
+void clock_skip_to(double time);
+
+//! Real seconds the given seconds of the clock take, 0 if virtual.
+double clock_real_duration(double duration);
+
 double time_now();
 void sleep_for(const double duration);
+
+//! Sleeps in real time whatever the clock, to wait on other threads.
+void sleep_real(const double duration);
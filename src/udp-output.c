@@ -0,0 +1,254 @@
+#define _GNU_SOURCE
+#include <assert.h>
+#include <errno.h>
+#include <netdb.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/random.h>
+
+#include "timer.h"
+
+#include "udp-output.h"
+
+#define TS_PACKET_SIZE 188
+
+// RTP fixed header, RFC 3550, Section 5.1.
+#define RTP_HEADER_SIZE 12
+// MPEG-2 transport streams, RFC 3551, Section 6.
+#define RTP_PAYLOAD_MP2T 33
+#define RTP_CLOCK 90000
+
+// Most Buffer links in what's sent at once.
+#define MAX_LINKS 1024
+
+static bool is_multicast(const struct sockaddr_storage *addr)
+{
+	if(addr->ss_family == AF_INET) {
+		const struct sockaddr_in *in = (const struct sockaddr_in *)addr;
+		return IN_MULTICAST(ntohl(in->sin_addr.s_addr));
+	}
+	const struct sockaddr_in6 *in6 = (const struct sockaddr_in6 *)addr;
+	return IN6_IS_ADDR_MULTICAST(&in6->sin6_addr);
+}
+
+static int set_ttl(UdpOutput *u, const int ttl)
+{
+	const bool v6 = u->addr.ss_family == AF_INET6;
+	int ret;
+	if(is_multicast(&u->addr)) {
+		if(v6) {
+			ret = setsockopt(u->fd, IPPROTO_IPV6, IPV6_MULTICAST_HOPS,
+				&ttl, sizeof ttl);
+		} else {
+			const unsigned char c = ttl;
+			ret = setsockopt(u->fd, IPPROTO_IP, IP_MULTICAST_TTL,
+				&c, sizeof c);
+		}
+	} else if(v6) {
+		ret = setsockopt(u->fd, IPPROTO_IPV6, IPV6_UNICAST_HOPS,
+			&ttl, sizeof ttl);
+	} else {
+		ret = setsockopt(u->fd, IPPROTO_IP, IP_TTL, &ttl, sizeof ttl);
+	}
+	return ret;
+}
+
+int udp_output_open(UdpOutput *u, const char *url, const int ttl,
+	const unsigned ts_per_datagram)
+{
+	memset(u, 0, sizeof *u);
+	u->fd = -1;
+
+	if(!strncmp(url, "rtp://", 6)) {
+		u->rtp = true;
+	} else if(strncmp(url, "udp://", 6)) {
+		return 1;
+	}
+	url += 6;
+
+	// host:port, or [host]:port for IPv6 addresses.
+	char host[256];
+	const char *port;
+	if(url[0] == '[') {
+		const char *close = strchr(url, ']');
+		if(!close || close[1] != ':' || close - url - 1 >= (int)sizeof host) {
+			fprintf(stderr, "Bad UDP destination '%s'\n", url);
+			return -1;
+		}
+		memcpy(host, url + 1, close - url - 1);
+		host[close - url - 1] = 0;
+		port = close + 2;
+	} else {
+		const char *colon = strrchr(url, ':');
+		if(!colon || colon - url >= (int)sizeof host) {
+			fprintf(stderr, "Bad UDP destination '%s'\n", url);
+			return -1;
+		}
+		memcpy(host, url, colon - url);
+		host[colon - url] = 0;
+		port = colon + 1;
+	}
+
+	struct addrinfo hints = {.ai_socktype = SOCK_DGRAM};
+	struct addrinfo *res;
+	const int err = getaddrinfo(host, port, &hints, &res);
+	if(err) {
+		fprintf(stderr, "Can't resolve '%s': %s\n", url, gai_strerror(err));
+		return -1;
+	}
+	memcpy(&u->addr, res->ai_addr, res->ai_addrlen);
+	u->addr_len = res->ai_addrlen;
+	u->fd = socket(res->ai_family, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+	freeaddrinfo(res);
+	if(u->fd < 0) {
+		perror("Failed to create UDP socket");
+		return -1;
+	}
+
+	if(ttl >= 0 && set_ttl(u, ttl) < 0) {
+		perror("Failed to set TTL");
+	}
+
+	u->ts_per_datagram = ts_per_datagram;
+	if(u->rtp) {
+		// Random initial values, as RFC 3550 recommends, so two
+		// senders started at once still get SSRCs of their own.
+		uint32_t r[3];
+		if(getrandom(r, sizeof r, 0) != sizeof r) {
+			perror("getrandom failed, seeding RTP from the clock");
+			srandom((unsigned)(time_now() * 1e9) ^ getpid());
+			for(size_t i = 0; i < 3; ++i) {
+				r[i] = random();
+			}
+		}
+		u->seq = r[0];
+		u->ssrc = r[1];
+		u->timestamp_offset = r[2];
+	}
+	return 0;
+}
+
+void udp_output_close(UdpOutput *u)
+{
+	if(u->fd >= 0) {
+		close(u->fd);
+	}
+	u->fd = -1;
+}
+
+static void rtp_header(UdpOutput *u, uint8_t *h, const uint32_t timestamp)
+{
+	// V=2, P=0, X=0, CC=0
+	h[0] = 0x80;
+	// M=0, PT
+	h[1] = RTP_PAYLOAD_MP2T;
+	h[2] = u->seq >> 8;
+	h[3] = u->seq & 0xff;
+	h[4] = timestamp >> 24;
+	h[5] = timestamp >> 16;
+	h[6] = timestamp >> 8;
+	h[7] = timestamp;
+	h[8] = u->ssrc >> 24;
+	h[9] = u->ssrc >> 16;
+	h[10] = u->ssrc >> 8;
+	h[11] = u->ssrc;
+	++u->seq;
+}
+
+// Sends the first n messages. A message that fails is dropped, and
+// the rest are still tried.
+static int send_batch(UdpOutput *u, struct mmsghdr *msgs, unsigned n)
+{
+	int ret = 0;
+	for(unsigned i = 0; i < n; ) {
+		const int sent = sendmmsg(u->fd, msgs + i, n - i, 0);
+		++u->send_calls;
+		if(sent < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			// sendmmsg() only fails on the first message it tries.
+			perror("Failed to send datagram");
+			++u->dropped;
+			++i;
+			ret = -1;
+			continue;
+		}
+		u->datagrams += sent;
+		i += sent;
+	}
+	return ret;
+}
+
+int udp_output_send(UdpOutput *u, const Buffer *data)
+{
+	struct iovec links[MAX_LINKS];
+	const int nlinks = buffer_iovec(data, links, MAX_LINKS, 0);
+
+	// Datagrams reference the links in place, preceded by their RTP
+	// header. TS output comes in a single link, see TS_packetize(), so
+	// a datagram never runs out of entries halfway through a packet.
+	struct mmsghdr msgs[UDP_OUTPUT_BATCH];
+	struct iovec iovs[UDP_OUTPUT_BATCH][UDP_OUTPUT_TS_PER_DATAGRAM + 2];
+	uint8_t headers[UDP_OUTPUT_BATCH][RTP_HEADER_SIZE];
+	const size_t datagram_size = u->ts_per_datagram * TS_PACKET_SIZE;
+	const size_t max_iov = sizeof iovs[0] / sizeof iovs[0][0];
+
+	// RFC 2250, Section 2: the time the first byte is sent, which is
+	// now for all of them.
+	const uint32_t timestamp = (uint64_t)(time_now() * RTP_CLOCK)
+		+ u->timestamp_offset;
+
+	int ret = 0;
+	unsigned n = 0;
+	int link = 0;
+	size_t offset = 0;
+	while(link < nlinks) {
+		struct msghdr *m = &msgs[n].msg_hdr;
+		memset(&msgs[n], 0, sizeof msgs[n]);
+		m->msg_name = &u->addr;
+		m->msg_namelen = u->addr_len;
+		m->msg_iov = iovs[n];
+
+		if(u->rtp) {
+			rtp_header(u, headers[n], timestamp);
+			iovs[n][m->msg_iovlen++] = (struct iovec){headers[n],
+				RTP_HEADER_SIZE};
+		}
+
+		size_t size = 0;
+		while(size < datagram_size && link < nlinks
+			&& m->msg_iovlen < max_iov)
+		{
+			size_t len = links[link].iov_len - offset;
+			if(len > datagram_size - size) {
+				len = datagram_size - size;
+			}
+			iovs[n][m->msg_iovlen++] = (struct iovec){
+				(uint8_t *)links[link].iov_base + offset, len};
+			size += len;
+			offset += len;
+			if(offset == links[link].iov_len) {
+				++link;
+				offset = 0;
+			}
+		}
+
+		assert(size % TS_PACKET_SIZE == 0);
+
+		if(++n == UDP_OUTPUT_BATCH) {
+			if(send_batch(u, msgs, n) < 0) {
+				ret = -1;
+			}
+			n = 0;
+		}
+	}
+	if(n && send_batch(u, msgs, n) < 0) {
+		ret = -1;
+	}
+	return ret;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/socket.h>
+
+#include "buffer.h"
+
+// TS packets per datagram, as tsudpsend sends by default.
+#define UDP_OUTPUT_TS_PER_DATAGRAM 7
+
+// Most datagrams given to a single sendmmsg() call.
+#define UDP_OUTPUT_BATCH 64
+
+// Sends TS packets straight to a UDP destination, unicast or multicast,
+// bare or in RTP as in RFC 2250.
+struct UdpOutput
+{
+	int fd;
+	struct sockaddr_storage addr;
+	socklen_t addr_len;
+	unsigned ts_per_datagram;
+
+	bool rtp;
+	uint16_t seq;
+	uint32_t ssrc;
+	uint32_t timestamp_offset;
+
+	uint64_t datagrams;
+	uint64_t send_calls;
+	// Datagrams not sent because sendmmsg() failed.
+	uint64_t dropped;
+};
+typedef struct UdpOutput UdpOutput;
+
+//! Opens an output to "udp://host:port" or "rtp://host:port". ttl is
+//! set for multicast or unicast, as it suits the destination, if not
+//! negative. Returns 1 if url is neither, -1 on error.
+int udp_output_open(UdpOutput *u, const char *url, int ttl,
+	unsigned ts_per_datagram);
+void udp_output_close(UdpOutput *u);
+
+//! Sends the TS packets in data, as many datagrams as they take.
+//! Returns -1 if any of them failed to be sent, after trying the
+//! rest, as errors like ECONNREFUSED or ENOBUFS may well pass.
+int udp_output_send(UdpOutput *u, const Buffer *data);
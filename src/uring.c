@@ -0,0 +1,156 @@
+#define _GNU_SOURCE
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#include "uring.h"
+
+int uring_init(Uring *r, const unsigned entries)
+{
+	memset(r, 0, sizeof *r);
+
+	struct io_uring_params p;
+	memset(&p, 0, sizeof p);
+	r->fd = syscall(__NR_io_uring_setup, entries, &p);
+	if(r->fd < 0) {
+		return -1;
+	}
+
+	r->sq_ring_size = p.sq_off.array + p.sq_entries * sizeof (unsigned);
+	r->cq_ring_size = p.cq_off.cqes
+		+ p.cq_entries * sizeof (struct io_uring_cqe);
+	// Since Linux 5.4, both rings are in a single mapping.
+	if(p.features & IORING_FEAT_SINGLE_MMAP) {
+		if(r->cq_ring_size > r->sq_ring_size) {
+			r->sq_ring_size = r->cq_ring_size;
+		}
+		r->cq_ring_size = 0;
+	}
+
+	r->sq_ring = mmap(NULL, r->sq_ring_size, PROT_READ | PROT_WRITE,
+		MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQ_RING);
+	if(r->sq_ring == MAP_FAILED) {
+		goto fail;
+	}
+	if(r->cq_ring_size) {
+		r->cq_ring = mmap(NULL, r->cq_ring_size, PROT_READ | PROT_WRITE,
+			MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_CQ_RING);
+		if(r->cq_ring == MAP_FAILED) {
+			goto fail;
+		}
+	} else {
+		r->cq_ring = r->sq_ring;
+	}
+
+	r->sqes_size = p.sq_entries * sizeof (struct io_uring_sqe);
+	r->sqes = mmap(NULL, r->sqes_size, PROT_READ | PROT_WRITE,
+		MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQES);
+	if(r->sqes == MAP_FAILED) {
+		goto fail;
+	}
+
+	char *sq = r->sq_ring;
+	r->sq_head = (_Atomic unsigned *)(sq + p.sq_off.head);
+	r->sq_tail = (_Atomic unsigned *)(sq + p.sq_off.tail);
+	r->sq_mask = *(unsigned *)(sq + p.sq_off.ring_mask);
+	r->sq_array = (unsigned *)(sq + p.sq_off.array);
+
+	char *cq = r->cq_ring;
+	r->cq_head = (_Atomic unsigned *)(cq + p.cq_off.head);
+	r->cq_tail = (_Atomic unsigned *)(cq + p.cq_off.tail);
+	r->cq_mask = *(unsigned *)(cq + p.cq_off.ring_mask);
+	r->cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+
+	return 0;
+
+fail:
+	{
+		const int err = errno;
+		uring_destroy(r);
+		errno = err;
+	}
+	return -1;
+}
+
+void uring_destroy(Uring *r)
+{
+	if(r->sqes && r->sqes != MAP_FAILED) {
+		munmap(r->sqes, r->sqes_size);
+	}
+	if(r->cq_ring_size && r->cq_ring && r->cq_ring != MAP_FAILED) {
+		munmap(r->cq_ring, r->cq_ring_size);
+	}
+	if(r->sq_ring && r->sq_ring != MAP_FAILED) {
+		munmap(r->sq_ring, r->sq_ring_size);
+	}
+	if(r->fd >= 0) {
+		close(r->fd);
+	}
+	memset(r, 0, sizeof *r);
+	r->fd = -1;
+}
+
+int uring_register_buffers(Uring *r, const struct iovec *iov,
+	const unsigned n)
+{
+	return syscall(__NR_io_uring_register, r->fd, IORING_REGISTER_BUFFERS,
+		iov, n);
+}
+
+struct io_uring_sqe *uring_get_sqe(Uring *r)
+{
+	const unsigned head = atomic_load_explicit(r->sq_head,
+		memory_order_acquire);
+	const unsigned tail = atomic_load_explicit(r->sq_tail,
+		memory_order_relaxed) + r->sq_pending;
+	if(tail - head > r->sq_mask) {
+		return NULL;
+	}
+
+	const unsigned index = tail & r->sq_mask;
+	r->sq_array[index] = index;
+	++r->sq_pending;
+
+	struct io_uring_sqe *sqe = &r->sqes[index];
+	memset(sqe, 0, sizeof *sqe);
+	return sqe;
+}
+
+int uring_submit(Uring *r, const unsigned wait_nr)
+{
+	// Publishes the SQEs to the kernel.
+	const unsigned tail = atomic_load_explicit(r->sq_tail,
+		memory_order_relaxed) + r->sq_pending;
+	atomic_store_explicit(r->sq_tail, tail, memory_order_release);
+	r->sq_pending = 0;
+
+	for(;;) {
+		// Whatever a signal kept the kernel from consuming.
+		const unsigned submit = tail
+			- atomic_load_explicit(r->sq_head, memory_order_acquire);
+		const int ret = syscall(__NR_io_uring_enter, r->fd, submit, wait_nr,
+			wait_nr ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+		if(ret >= 0 || errno != EINTR) {
+			return ret;
+		}
+	}
+}
+
+struct io_uring_cqe *uring_peek_cqe(Uring *r)
+{
+	const unsigned head = atomic_load_explicit(r->cq_head,
+		memory_order_relaxed);
+	if(head == atomic_load_explicit(r->cq_tail, memory_order_acquire)) {
+		return NULL;
+	}
+	return &r->cqes[head & r->cq_mask];
+}
+
+void uring_cqe_seen(Uring *r)
+{
+	const unsigned head = atomic_load_explicit(r->cq_head,
+		memory_order_relaxed);
+	atomic_store_explicit(r->cq_head, head + 1, memory_order_release);
+}
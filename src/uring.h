@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <sys/uio.h>
+#include <linux/io_uring.h>
+
+// Just enough of io_uring for the output writer, on the raw system
+// calls, as liburing may not be around. Not thread safe: a ring
+// belongs to a single thread.
+struct Uring
+{
+	int fd;
+
+	// Submission queue, shared with the kernel.
+	_Atomic unsigned *sq_head;
+	_Atomic unsigned *sq_tail;
+	unsigned sq_mask;
+	unsigned *sq_array;
+	struct io_uring_sqe *sqes;
+	// SQEs taken by uring_get_sqe() and not yet submitted.
+	unsigned sq_pending;
+
+	// Completion queue, shared with the kernel.
+	_Atomic unsigned *cq_head;
+	_Atomic unsigned *cq_tail;
+	unsigned cq_mask;
+	struct io_uring_cqe *cqes;
+
+	void *sq_ring;
+	size_t sq_ring_size;
+	void *cq_ring;
+	size_t cq_ring_size;
+	size_t sqes_size;
+};
+typedef struct Uring Uring;
+
+//! Sets up a ring of entries SQEs. Returns -1, with errno set, if
+//! io_uring isn't available.
+int uring_init(Uring *r, unsigned entries);
+void uring_destroy(Uring *r);
+
+//! Registers buffers for IORING_OP_WRITE_FIXED, buf_index being the
+//! index in iov. Returns -1 on failure.
+int uring_register_buffers(Uring *r, const struct iovec *iov, unsigned n);
+
+//! Next free SQE, cleared, or NULL if the queue is full.
+struct io_uring_sqe *uring_get_sqe(Uring *r);
+
+//! Submits the pending SQEs, and waits for at least wait_nr
+//! completions. Returns what io_uring_enter() returns.
+int uring_submit(Uring *r, unsigned wait_nr);
+
+//! Oldest completion not yet seen, or NULL.
+struct io_uring_cqe *uring_peek_cqe(Uring *r);
+
+//! Frees the completion returned by uring_peek_cqe().
+void uring_cqe_seen(Uring *r);
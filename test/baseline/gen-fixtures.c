@@ -0,0 +1,195 @@
+// Writes the golden fixtures from the encoder as it was before the
+// performance work, for test/check-golden.c to hold the current one
+// to. test/baseline/gen-fixtures.sh builds this against the sources
+// of that commit: main() of its arib-write.c is included, unused, for
+// the static functions that build and write the packets, and the line
+// handling of main() is repeated here, on the shared transcript.
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Its own line reader would clash with the POSIX one, declared above.
+#define getline baseline_getline
+#define main baseline_main
+#include "arib-write.c"
+#undef main
+#undef getline
+
+#include "../golden-transcript.h"
+
+#define LINES 2
+#define TS_PID 0x100
+
+// The clock, in milliseconds, moved to each transcript time instead of
+// waited for. Starts away from 0, which PES-write.c takes as unset.
+static uint64_t clock_ms;
+
+double time_now()
+{
+	return 1000.0 + clock_ms * 1e-3;
+}
+
+void sleep_for(const double duration)
+{
+	clock_ms += (uint64_t)round(duration * 1000);
+}
+
+// Caption being assembled, as in main().
+static char msg[4096];
+static uint16_t count;
+static uint8_t line_count;
+
+// Adds a line as main() did, and tells if the caption is complete.
+static bool push_line(iconv_t cd, const char *text)
+{
+	uint16_t ncount = count;
+	if(seg_type == FULL_SEG) {
+		msg[ncount++] = 0x1c;
+		msg[ncount++] = 0x4d + line_count;
+		msg[ncount++] = 0x40;
+	} else {
+		msg[ncount++] = 0x0d;
+	}
+
+	size_t remsize = 4095 - ncount;
+	size_t bn = strlen(text);
+	char *in = (char *)text;
+	char *out = &msg[ncount];
+	iconv(cd, &in, &bn, &out, &remsize);
+	const size_t n = out - &msg[ncount];
+
+	if(msg[ncount] == '\n') {
+		return line_count != 0;
+	}
+	count = ncount + n;
+	++line_count;
+	return line_count == LINES;
+}
+
+static void send_caption(FILE *out)
+{
+	write_full_subtitle(out, count, msg);
+	count = 0;
+	line_count = 0;
+}
+
+// Wraps each PES packet in TS packets on TS_PID, from ISO 13818-1,
+// section 2.4.3.2, with stuffing in the adaptation field. The baseline
+// had no TS output; this follows ARIB TR-B14 in never leaving the last
+// byte of a PES, half of the CRC, alone in a TS packet.
+static void write_ts(FILE *f, const uint8_t *pes, size_t size)
+{
+	uint8_t cc = 0;
+	while(size) {
+		size_t remaining = 6 + (pes[4] << 8 | pes[5]);
+		assert(remaining <= size);
+		size -= remaining;
+
+		bool first = true;
+		while(remaining) {
+			size_t payload = remaining < 184 ? remaining : 184;
+			if(remaining - payload == 1) {
+				--payload;
+			}
+			const size_t af_size = 184 - payload;
+
+			uint8_t p[188];
+			p[0] = 0x47;
+			p[1] = (first ? 0x40 : 0x00) | (TS_PID >> 8);
+			p[2] = TS_PID & 0xff;
+			p[3] = (af_size ? 0x30 : 0x10) | cc;
+			cc = (cc + 1) & 0x0f;
+			if(af_size) {
+				p[4] = af_size - 1;
+				if(af_size > 1) {
+					p[5] = 0;
+					memset(&p[6], 0xff, af_size - 2);
+				}
+			}
+			memcpy(&p[4 + af_size], pes, payload);
+			fwrite(p, 1, sizeof p, f);
+
+			pes += payload;
+			remaining -= payload;
+			first = false;
+		}
+	}
+}
+
+static int save(const char *path, const uint8_t *data, size_t size, bool ts)
+{
+	FILE *f = fopen(path, "wb");
+	if(!f) {
+		perror(path);
+		return -1;
+	}
+	if(ts) {
+		write_ts(f, data, size);
+	} else {
+		fwrite(data, 1, size, f);
+	}
+	if(fclose(f)) {
+		perror(path);
+		return -1;
+	}
+	return 0;
+}
+
+int main(int argc, char *argv[])
+{
+	if(argc != 4 || (strcmp(argv[1], "full") && strcmp(argv[1], "one"))) {
+		fprintf(stderr, "Usage: %s full|one <pes> <ts>\n", argv[0]);
+		return 1;
+	}
+	seg_type = strcmp(argv[1], "one") ? FULL_SEG : ONE_SEG;
+
+	// Packets are written with writev() on its descriptor.
+	FILE *out = tmpfile();
+	if(!out) {
+		perror("tmpfile");
+		return 1;
+	}
+	iconv_t cd = iconv_open("l1", "utf8");
+
+	uint64_t next_management = 0;
+	for(size_t i = 0; i < NLINES; ++i) {
+		const Line *l = &transcript[i];
+		for(; next_management <= l->ms; next_management += MANAGEMENT_MS) {
+			clock_ms = next_management;
+			write_caption_management_data(out);
+		}
+
+		clock_ms = l->ms;
+		if(push_line(cd, l->text)) {
+			send_caption(out);
+		}
+	}
+
+	// main() dropped a caption left over at the end of its input,
+	// and never cleared the screen: sent here as the captions they are.
+	clock_ms = END_MS;
+	if(line_count) {
+		send_caption(out);
+	}
+	clock_ms = CLEAR_MS;
+	send_caption(out);
+
+	iconv_close(cd);
+
+	fseek(out, 0, SEEK_END);
+	const size_t size = ftell(out);
+	uint8_t *pes = malloc(size);
+	rewind(out);
+	if(fread(pes, 1, size, out) != size) {
+		perror("fread");
+		return 1;
+	}
+	fclose(out);
+
+	const int ret = save(argv[2], pes, size, false) < 0
+		|| save(argv[3], pes, size, true) < 0;
+	free(pes);
+	return ret;
+}
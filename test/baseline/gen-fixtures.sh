@@ -0,0 +1,17 @@
+#!/bin/sh
+# Writes test/fixtures from the encoder before the performance work,
+# commit 65e8de1, built with test/baseline/gen-fixtures.c for a clock.
+# Run from the top of the repository.
+set -e
+
+BASELINE=${BASELINE:-65e8de1}
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+git archive "$BASELINE" src | tar -x -C "$tmp"
+cc -std=c11 -Wall -Wextra -g -I"$tmp/src" -o "$tmp/gen-fixtures" \
+	test/baseline/gen-fixtures.c "$tmp/src/PES-write.c" \
+	"$tmp/src/buffer.c" "$tmp/src/data-group.c" -lm
+
+"$tmp/gen-fixtures" full test/fixtures/full-seg.pes test/fixtures/full-seg.ts
+"$tmp/gen-fixtures" one test/fixtures/one-seg.pes test/fixtures/one-seg.ts
@@ -0,0 +1,97 @@
+// Batch encoding of an SRT file whose cues crowd each other and the
+// management data: PES packets must still be PES_MIN_INTERVAL apart,
+// in PTS order. Cues of more than 255 lines are fine, and a cue too
+// long for one caption is skipped rather than cut short. A line with
+// only characters the caption sets lack is dropped, not taken for the
+// blank line ending the cue.
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "batch.h"
+
+#include "check.h"
+
+static void write_cue(FILE *f, const unsigned n, const char *timing,
+	const unsigned lines)
+{
+	fprintf(f, "%u\n%s\n", n, timing);
+	for(unsigned i = 0; i < lines; ++i) {
+		fprintf(f, "a\n");
+	}
+	fprintf(f, "\n");
+}
+
+static void write_cue_text(FILE *f, const unsigned n, const char *timing,
+	const char *text)
+{
+	fprintf(f, "%u\n%s\n%s\n\n", n, timing, text);
+}
+
+static bool contains(const uint8_t *data, const long size, const char *s)
+{
+	return memmem(data, size, s, strlen(s)) != NULL;
+}
+
+void check_batch(void)
+{
+	char path[] = "/tmp/check-batch-XXXXXX";
+	const int fd = mkstemp(path);
+	if(!CHECK(fd >= 0)) {
+		return;
+	}
+	FILE *srt = fdopen(fd, "w");
+	// At the same time as management data, then 1 ms apart.
+	write_cue(srt, 1, "00:00:01,000 --> 00:00:01,001", 1);
+	write_cue(srt, 2, "00:00:01,002 --> 00:00:01,003", 1);
+	write_cue(srt, 3, "00:00:01,004 --> 00:00:03,000", 300);
+	write_cue(srt, 4, "00:00:04,000 --> 00:00:05,000", 2000);
+	write_cue(srt, 5, "00:00:06,000 --> 00:00:07,000", 1);
+	write_cue_text(srt, 6, "00:00:08,000 --> 00:00:09,000",
+		"hello\n\u20ac\nthere");
+	write_cue_text(srt, 7, "00:00:10,000 --> 00:00:11,000",
+		"\u20ac \U0001f600\xff\nagain");
+	fclose(srt);
+
+	CaptionConfig config = CAPTION_CONFIG_DEFAULT;
+	config.pts_origin = 900000;
+	FILE *out = tmpfile();
+	CHECK(batch_run(&config, path, out) == 0);
+	unlink(path);
+	arena_free(arena_thread());
+
+	const long size = ftell(out);
+	uint8_t *pes = malloc(size);
+	rewind(out);
+	CHECK(fread(pes, 1, size, out) == (size_t)size);
+	fclose(out);
+
+	unsigned packets = 0, statements = 0;
+	uint64_t last = 0;
+	for(long i = 0; i + PES_HEADER_SIZE < size;
+		i += 6 + (pes[i + 4] << 8 | pes[i + 5]))
+	{
+		const uint8_t *p = pes + i + PES_PTS_OFFSET;
+		const uint64_t pts = (uint64_t)(p[0] >> 1 & 7) << 30 | p[1] << 22
+			| (p[2] >> 1) << 15 | p[3] << 7 | p[4] >> 1;
+		if(packets && !CHECK(pts_diff(pts, last) >= PES_MIN_INTERVAL * PTS_HZ)) {
+			fprintf(stderr, "packet %u: PTS %llu after %llu\n", packets,
+				(unsigned long long)pts, (unsigned long long)last);
+		}
+		// data_group_id, 0 for management data.
+		statements += (pes[i + PES_HEADER_SIZE] >> 2 & 0x1f) != 0;
+		last = pts;
+		++packets;
+	}
+	CHECK(contains(pes, size, "hello"));
+	CHECK(contains(pes, size, "there"));
+	CHECK(contains(pes, size, "again"));
+	free(pes);
+
+	// 6 cues shown, each cleared, the one too long skipped.
+	CHECK(statements == 12);
+	check_metric("packets", packets);
+}
@@ -0,0 +1,72 @@
+// Data too big for one PES packet: every packet must carry exactly one
+// whole data group of the chain, with its link numbers in order, and
+// the chain must hold the data as given.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "data-group.h"
+
+#include "check.h"
+
+static void check_chain(const size_t size, const uint8_t *payload)
+{
+	DataGroupStream dg = {.pes.pts_source = PTS_CUE};
+	Buffer data = {0};
+	buffer_prepend_ref(&data, payload, size);
+	data_unit(&dg, STATEMENT_1, STATEMENT_BODY, &data);
+
+	Bytes bytes = {0};
+	bytes_append(&bytes, &data);
+	buffer_destroy(&data);
+	CHECK(bytes.size == data_unit_encoded_size(STATEMENT_1, size));
+
+	// Data of the chain, past the data unit and statement headers.
+	size_t joined = 0;
+	unsigned link = 0, last = 0;
+	for(size_t i = 0; i + PES_HEADER_SIZE <= bytes.size; ++link) {
+		const uint8_t *pes = bytes.data + i;
+		const size_t pes_size = 6 + (pes[4] << 8 | pes[5]);
+		const uint8_t *group = pes + PES_HEADER_SIZE;
+		const size_t group_size = group[3] << 8 | group[4];
+
+		if(!CHECK(pes_size - PES_HEADER_SIZE == 5 + group_size + 2)
+			|| !CHECK(pes_size <= 32768)
+			|| !CHECK(group[1] == link))
+		{
+			fprintf(stderr, "data of %zu bytes, link %u\n", size, link);
+			break;
+		}
+		if(link == 0) {
+			last = group[2];
+		}
+		CHECK(group[2] == last);
+
+		// data_unit and statement headers lead the first group.
+		const size_t skip = link == 0 ? 4 + 5 : 0;
+		CHECK(!memcmp(group + 5 + skip, payload + joined, group_size - skip));
+		joined += group_size - skip;
+		i += pes_size;
+	}
+	CHECK(link == last + 1);
+	CHECK(joined == size);
+	bytes_free(&bytes);
+}
+
+void check_chain_sizes(void)
+{
+	static uint8_t payload[4 << 20];
+	for(size_t i = 0; i < sizeof payload; ++i) {
+		payload[i] = i * 7 + (i >> 11);
+	}
+
+	// Around every multiple of a whole group, and a big one.
+	for(size_t k = 1; k <= 4; ++k) {
+		const size_t edge = k * (PES_MAX_PAYLOAD - 7) - 9;
+		for(size_t size = edge - 2; size <= edge + 2; ++size) {
+			check_chain(size, payload);
+		}
+	}
+	check_chain(sizeof payload, payload);
+}
@@ -0,0 +1,77 @@
+// The generated JIS table against the EUC-JP converter of the C
+// library, and the codes charset_encode() produces for text in each
+// of the sets it handles.
+
+#include <iconv.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "charset.h"
+#include "jis-table.h"
+
+#include "check.h"
+
+static void check_table(void)
+{
+	iconv_t cd = iconv_open("UTF-32LE", "EUC-JP");
+	if(cd == (iconv_t)-1) {
+		fprintf(stderr, "No EUC-JP converter, JIS table not checked\n");
+		return;
+	}
+
+	unsigned codes = 0;
+	for(unsigned row = 0x21; row <= 0x7e; ++row) {
+		for(unsigned col = 0x21; col <= 0x7e; ++col) {
+			char euc[2] = {row | 0x80, col | 0x80};
+			uint8_t ucs[4];
+			char *in = euc, *o = (char *)ucs;
+			size_t in_size = sizeof euc, out_size = sizeof ucs;
+			if(iconv(cd, &in, &in_size, &o, &out_size) == (size_t)-1
+				|| out_size)
+			{
+				iconv(cd, NULL, NULL, NULL, NULL);
+				continue;
+			}
+
+			const uint32_t cp = ucs[0] | ucs[1] << 8
+				| ucs[2] << 16 | (uint32_t)ucs[3] << 24;
+			const uint16_t jis = jis_table_lookup(cp);
+			// Either its code, or an earlier one of a duplicate.
+			if(!CHECK(jis && jis <= (row << 8 | col))) {
+				fprintf(stderr, "U+%04X: JIS %04x, table %04x\n",
+					cp, row << 8 | col, jis);
+			}
+			++codes;
+		}
+	}
+	iconv_close(cd);
+	CHECK(codes > 6000);
+}
+
+static void check_encode(const char *text, const char *want, size_t size)
+{
+	CharsetState state;
+	charset_reset(&state);
+	uint8_t out[256];
+	const size_t n = charset_encode(&state, text, strlen(text),
+		out, sizeof out);
+	if(!CHECK(n == size && !memcmp(out, want, size))) {
+		fprintf(stderr, "encoding '%s'\n", text);
+	}
+}
+
+#define CHECK_ENCODE(text, want) check_encode(text, want, sizeof want - 1)
+
+void check_charset(void)
+{
+	check_table();
+
+	CHECK_ENCODE("Olá, ação!", "Ol\xe1, a\xe7\xe3o!");
+	// Designation of the Kanji set once, then shifts as needed.
+	CHECK_ENCODE("日本 a 語",
+		"\x1b\x24\x29\x42\x0e\x46\x7c\x4b\x5c \x0f" "a \x0e\x38\x6c");
+	// C1 controls and characters in no set are dropped.
+	CHECK_ENCODE("a\xc2\x85" "b€c", "abc");
+	// So is malformed UTF-8, a byte at a time.
+	CHECK_ENCODE("a\xc3" "b\xff" "c", "abc");
+}
@@ -0,0 +1,42 @@
+// CRC-16 implementations against each other, on every length up to a
+// few blocks of the widest one and at every alignment, and against
+// the check value of CRC-16/XMODEM.
+
+#include <stdio.h>
+
+#include "crc.h"
+
+#include "check.h"
+
+void check_crc(void)
+{
+	CHECK(crc16_update(0, (const uint8_t *)"123456789", 9) == 0x31c3);
+
+	static uint8_t data[1024 + 16];
+	for(size_t i = 0; i < sizeof data; ++i) {
+		data[i] = i * 167 + (i >> 3);
+	}
+
+	const CRC16Func clmul = crc16_clmul_func();
+	for(size_t offset = 0; offset < 16; ++offset) {
+		for(size_t size = 0; size <= 1024; ++size) {
+			const uint8_t *d = data + offset;
+			const uint16_t want = crc16_update_bitwise(0x1d0f, d, size);
+			if(!CHECK(crc16_update_slice8(0x1d0f, d, size) == want)
+				|| (clmul && !CHECK(clmul(0x1d0f, d, size) == want))
+				|| !CHECK(crc16_update(0x1d0f, d, size) == want))
+			{
+				fprintf(stderr, "%zu bytes at offset %zu\n", size, offset);
+				return;
+			}
+		}
+	}
+
+	// In chunks, as buffer_CRC16() feeds links.
+	uint16_t crc = 0;
+	for(size_t i = 0; i < sizeof data; i += 100) {
+		const size_t n = sizeof data - i < 100 ? sizeof data - i : 100;
+		crc = crc16_update(crc, data + i, n);
+	}
+	CHECK(crc == crc16_update_bitwise(0, data, sizeof data));
+}
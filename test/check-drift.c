@@ -0,0 +1,89 @@
+// PTS over a simulated day of captions, one every 2.437 s, against the
+// exact time each should be presented at. With timecodes, from an
+// origin the 33-bit PTS wraps around from halfway through, they must
+// match to the tick. From the wall clock, run virtually, rounding may
+// cost a tick but must never accumulate.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "caption.h"
+#include "timer.h"
+
+#include "check.h"
+
+#define DAY_MS (UINT64_C(24) * 3600 * 1000)
+#define STEP_MS 2437
+
+static uint64_t packet_pts(Buffer *pes)
+{
+	uint8_t h[PES_PTS_OFFSET + 5];
+	BufferReader r;
+	buffer_reader_init(&r, pes);
+	buffer_read(&r, h, sizeof h);
+	const uint8_t *p = h + PES_PTS_OFFSET;
+	return (uint64_t)(p[0] >> 1 & 7) << 30 | p[1] << 22 | (p[2] >> 1) << 15
+		| p[3] << 7 | p[4] >> 1;
+}
+
+// Largest PTS error, in 90 kHz ticks, of a day of captions.
+static int64_t day_drift(const PTSSource source, const uint64_t origin)
+{
+	CaptionConfig config = CAPTION_CONFIG_DEFAULT;
+	config.lines = 1;
+	config.pts_source = source;
+	config.pts_origin = origin;
+	CaptionStream cs;
+	caption_stream_init(&cs, &config);
+	Arena arena = {0};
+
+	int64_t max = 0;
+	unsigned captions = 0;
+	for(uint64_t ms = 0; ms < DAY_MS; ms += STEP_MS, ++captions) {
+		char line[64];
+		const unsigned s = ms / 1000;
+		int size;
+		if(source == PTS_TIMECODE) {
+			size = snprintf(line, sizeof line, "%02u:%02u:%02u.%03u Fala %u\n",
+				s / 3600, s / 60 % 60, s % 60, (unsigned)(ms % 1000), captions);
+		} else {
+			if(ms) {
+				sleep_for(STEP_MS / 1000.0);
+			}
+			size = snprintf(line, sizeof line, "Fala %u\n", captions);
+		}
+
+		Buffer pes;
+		if(!CHECK(caption_push_line(&cs, &arena, line, size, &pes))) {
+			break;
+		}
+		int64_t drift = pts_diff(packet_pts(&pes), pts_add_ms(origin, ms));
+		if(drift < 0) {
+			drift = -drift;
+		}
+		if(drift > max) {
+			max = drift;
+		}
+		buffer_destroy(&pes);
+		arena_reset(&arena);
+	}
+	CHECK(captions == DAY_MS / STEP_MS + 1);
+
+	caption_stream_destroy(&cs);
+	arena_free(&arena);
+	return max;
+}
+
+void check_drift(void)
+{
+	const uint64_t wrap_origin = PTS_MASK + 1 - DAY_MS / 2 * (PTS_HZ / 1000);
+	const int64_t timecode = day_drift(PTS_TIMECODE, wrap_origin);
+	check_metric("timecode_max_drift_ticks", timecode);
+	CHECK(timecode == 0);
+
+	clock_select(CLOCK_MODE_VIRTUAL, 1.0);
+	const int64_t wall = day_drift(PTS_WALL_CLOCK, 900000);
+	clock_select(CLOCK_MODE_REAL, 1.0);
+	check_metric("wall_clock_max_drift_ticks", wall);
+	CHECK(wall <= 1);
+}
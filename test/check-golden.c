@@ -0,0 +1,81 @@
+// Whole encoder chain against fixtures: captions with fixed cue
+// times, so PTS doesn't depend on the clock, in every output format.
+// The fixtures come from the encoder before the performance work, by
+// test/baseline/gen-fixtures.sh, with PTS 0 at the first packet as it
+// had. Encoding changes that aren't meant to change bytes must keep
+// these.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "caption.h"
+#include "check.h"
+#include "golden-transcript.h"
+
+static void emit(CaptionStream *cs, Arena *arena, Buffer *pes, Bytes *bytes)
+{
+	while(buffer_get_size(pes)) {
+		Buffer wire;
+		caption_next_packet(cs, arena, pes, &wire);
+		bytes_append(bytes, &wire);
+		buffer_destroy(&wire);
+	}
+	buffer_destroy(pes);
+	arena_reset(arena);
+}
+
+static void encode(const CaptionConfig *config, Bytes *bytes)
+{
+	CaptionStream cs;
+	caption_stream_init(&cs, config);
+	Arena arena = {0};
+	Buffer pes;
+
+	uint64_t next_management = 0;
+	for(size_t i = 0; i < NLINES; ++i) {
+		const Line *l = &transcript[i];
+		for(; next_management <= l->ms; next_management += MANAGEMENT_MS) {
+			caption_set_time(&cs, next_management);
+			caption_management(&cs, &arena, &pes);
+			emit(&cs, &arena, &pes, bytes);
+		}
+
+		caption_set_time(&cs, l->ms);
+		if(caption_push_line(&cs, &arena, l->text, strlen(l->text), &pes)) {
+			emit(&cs, &arena, &pes, bytes);
+		}
+	}
+
+	caption_set_time(&cs, END_MS);
+	if(caption_flush(&cs, &arena, &pes)) {
+		emit(&cs, &arena, &pes, bytes);
+	}
+	caption_set_time(&cs, CLEAR_MS);
+	caption_clear(&cs, &arena, &pes);
+	emit(&cs, &arena, &pes, bytes);
+
+	caption_stream_destroy(&cs);
+	free(arena.base);
+}
+
+static void golden(const char *name, const SegType seg_type,
+	const bool ts_output)
+{
+	CaptionConfig config = CAPTION_CONFIG_DEFAULT;
+	config.seg_type = seg_type;
+	config.ts_output = ts_output;
+	config.pts_source = PTS_CUE;
+
+	Bytes bytes = {0};
+	encode(&config, &bytes);
+	check_fixture(name, &bytes);
+	bytes_free(&bytes);
+}
+
+void check_golden(void)
+{
+	golden("full-seg.pes", FULL_SEG, false);
+	golden("full-seg.ts", FULL_SEG, true);
+	golden("one-seg.pes", ONE_SEG, false);
+	golden("one-seg.ts", ONE_SEG, true);
+}
@@ -0,0 +1,42 @@
+// data_unit_encoded_size() against what data_unit() actually encodes,
+// for every payload a single PES packet can carry. caption.c relies on
+// it to decide padding before encoding.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "data-group.h"
+
+#include "check.h"
+
+static void check_type(const CaptionDataType cd_type)
+{
+	static uint8_t payload[PES_MAX_PAYLOAD];
+	memset(payload, 0xaa, sizeof payload);
+
+	DataGroupStream dg = {.pes.pts_source = PTS_CUE};
+	Arena arena = {0};
+	for(size_t size = 0; size <= PES_MAX_PAYLOAD; ++size) {
+		Buffer data;
+		memcpy(buffer_init_reserved(&data, &arena, size, 128, 2),
+			payload, size);
+		data_unit(&dg, cd_type, STATEMENT_BODY, &data);
+
+		const size_t encoded = buffer_get_size(&data);
+		const size_t predicted = data_unit_encoded_size(cd_type, size);
+		if(!CHECK(encoded == predicted)) {
+			fprintf(stderr, "payload of %zu bytes: %zu predicted, "
+				"%zu encoded\n", size, predicted, encoded);
+		}
+		buffer_destroy(&data);
+		arena_reset(&arena);
+	}
+	free(arena.base);
+}
+
+void check_size(void)
+{
+	check_type(STATEMENT_1);
+	check_type(OLD_MANAGEMENT);
+}
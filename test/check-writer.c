@@ -0,0 +1,59 @@
+// libaribwrite refuses configurations the encoder can't honor, rather
+// than asserting on them halfway through a caption.
+
+#include <errno.h>
+
+#include "arib-writer.h"
+
+#include "check.h"
+
+static int count_sink(void *par, const struct iovec *iov, const int iovcnt)
+{
+	(void)iov;
+	(void)iovcnt;
+	++*(unsigned *)par;
+	return 0;
+}
+
+// Whether arib_writer_new() refuses config with EINVAL.
+static bool refused(const AribWriterConfig *config)
+{
+	unsigned packets = 0;
+	errno = 0;
+	AribWriter *w = arib_writer_new(config, count_sink, &packets);
+	arib_writer_free(w);
+	return !w && errno == EINVAL;
+}
+
+void check_writer(void)
+{
+	const AribWriterConfig good = ARIB_WRITER_CONFIG_DEFAULT;
+	AribWriterConfig c;
+
+	c = good; c.sdp_x = -1; CHECK(refused(&c));
+	c = good; c.sdp_y = 1000; CHECK(refused(&c));
+	c = good; c.lines = 0; CHECK(refused(&c));
+	c = good; c.lines = ARIB_MAX_LINES + 1; CHECK(refused(&c));
+	c = good; c.seg_type = (AribSegType)2; CHECK(refused(&c));
+	c = good; c.pts_source = (AribPTSSource)3; CHECK(refused(&c));
+	c = good; c.ts_output = true; c.pid = 0x2000; CHECK(refused(&c));
+	CHECK(!arib_writer_new(&good, NULL, NULL) && errno == EINVAL);
+
+	// The limits themselves are fine, and so is any PID without TS.
+	unsigned packets = 0;
+	c = good;
+	c.sdp_x = 999;
+	c.sdp_y = 0;
+	c.lines = ARIB_MAX_LINES;
+	c.pid = 0;
+	c.pts_source = ARIB_PTS_CUE;
+	AribWriter *w = arib_writer_new(&c, count_sink, &packets);
+	if(!CHECK(w)) {
+		return;
+	}
+	for(int i = 0; i < ARIB_MAX_LINES; ++i) {
+		CHECK(arib_writer_push_line(w, "linha\n", 6) == 0);
+	}
+	CHECK(packets == 1);
+	arib_writer_free(w);
+}
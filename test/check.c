@@ -0,0 +1,166 @@
+// Regression checks of the encoder chain, run by make check.
+//
+//	make check
+//	build/check [name...]
+//
+// Prints one JSON object per check, one per line, and exits with 1 if
+// any failed.
+
+#define _POSIX_C_SOURCE 200809L
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "check.h"
+
+#define FIXTURES "test/fixtures/"
+
+// Most measurements reported by one check.
+#define MAX_METRICS 8
+
+struct Check
+{
+	const char *name;
+	void (*run)(void);
+};
+typedef struct Check Check;
+
+static const Check checks[] = {
+	{"golden", check_golden},
+	{"batch", check_batch},
+	{"chain", check_chain_sizes},
+	{"charset", check_charset},
+	{"crc", check_crc},
+	{"drift", check_drift},
+	{"size", check_size},
+	{"writer", check_writer},
+};
+#define NCHECKS (sizeof checks / sizeof checks[0])
+
+// Failures and measurements of the check being run.
+static unsigned failures;
+static struct
+{
+	const char *name;
+	double value;
+} metrics[MAX_METRICS];
+static size_t nmetrics;
+
+bool check_true(const bool ok, const char *what, const char *file,
+	const int line)
+{
+	if(!ok) {
+		fprintf(stderr, "%s:%d: check failed: %s\n", file, line, what);
+		++failures;
+	}
+	return ok;
+}
+
+// Room for size more bytes at the end of bytes.
+static uint8_t *bytes_reserve(Bytes *bytes, const size_t size)
+{
+	if(bytes->size + size > bytes->capacity) {
+		size_t capacity = bytes->capacity ? bytes->capacity : 4096;
+		while(capacity < bytes->size + size) {
+			capacity *= 2;
+		}
+		bytes->data = realloc(bytes->data, capacity);
+		if(!bytes->data) {
+			perror("realloc");
+			exit(2);
+		}
+		bytes->capacity = capacity;
+	}
+	return bytes->data + bytes->size;
+}
+
+void check_metric(const char *name, const double value)
+{
+	if(nmetrics < MAX_METRICS) {
+		metrics[nmetrics].name = name;
+		metrics[nmetrics].value = value;
+		++nmetrics;
+	}
+}
+
+void bytes_append(Bytes *bytes, const Buffer *buf)
+{
+	const size_t size = buffer_get_size((Buffer *)buf);
+	bytes_reserve(bytes, size);
+
+	BufferReader r;
+	buffer_reader_init(&r, buf);
+	bytes->size += buffer_read(&r, bytes->data + bytes->size, size);
+}
+
+void bytes_free(Bytes *bytes)
+{
+	free(bytes->data);
+	*bytes = (Bytes){0};
+}
+
+bool check_fixture(const char *name, const Bytes *bytes)
+{
+	char path[256];
+	snprintf(path, sizeof path, FIXTURES "%s", name);
+	FILE *f = fopen(path, "rb");
+	if(!f) {
+		fprintf(stderr, "%s: %s\n", path, strerror(errno));
+		return CHECK(false);
+	}
+	Bytes want = {0};
+	size_t n;
+	while((n = fread(bytes_reserve(&want, 4096), 1, 4096, f)) > 0) {
+		want.size += n;
+	}
+	fclose(f);
+
+	size_t i = 0;
+	while(i < want.size && i < bytes->size && want.data[i] == bytes->data[i]) {
+		++i;
+	}
+	const bool same = i == want.size && i == bytes->size;
+	if(!same) {
+		fprintf(stderr, "%s: %zu bytes expected, %zu encoded, "
+			"first difference at offset %zu\n",
+			path, want.size, bytes->size, i);
+	}
+	bytes_free(&want);
+	return CHECK(same);
+}
+
+static bool selected(const char *name, int argc, char *argv[])
+{
+	if(argc < 2) {
+		return true;
+	}
+	for(int i = 1; i < argc; ++i) {
+		if(strcmp(argv[i], name) == 0) {
+			return true;
+		}
+	}
+	return false;
+}
+
+int main(int argc, char *argv[])
+{
+	unsigned failed = 0;
+	for(size_t i = 0; i < NCHECKS; ++i) {
+		if(!selected(checks[i].name, argc, argv)) {
+			continue;
+		}
+		failures = 0;
+		nmetrics = 0;
+		checks[i].run();
+		printf("{\"check\": \"%s\", \"ok\": %s, \"failures\": %u",
+			checks[i].name, failures ? "false" : "true", failures);
+		for(size_t m = 0; m < nmetrics; ++m) {
+			printf(", \"%s\": %.6g", metrics[m].name, metrics[m].value);
+		}
+		printf("}\n");
+		fflush(stdout);
+		failed += failures != 0;
+	}
+	return failed ? 1 : 0;
+}
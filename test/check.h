@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "buffer.h"
+
+// Records a failed condition, with where it was checked, and carries
+// on, so one run reports every failure.
+#define CHECK(cond) check_true((cond), #cond, __FILE__, __LINE__)
+
+bool check_true(bool ok, const char *what, const char *file, int line);
+
+//! Adds a measurement to the result of the check being run.
+void check_metric(const char *name, double value);
+
+// Bytes of encoded packets, collected to be compared.
+struct Bytes
+{
+	uint8_t *data;
+	size_t size;
+	size_t capacity;
+};
+typedef struct Bytes Bytes;
+
+void bytes_append(Bytes *bytes, const Buffer *buf);
+void bytes_free(Bytes *bytes);
+
+//! Compares bytes with the fixture of that name in test/fixtures,
+//! which test/baseline/gen-fixtures.sh writes.
+bool check_fixture(const char *name, const Bytes *bytes);
+
+// Checks, one per test file.
+void check_golden(void);
+void check_batch(void);
+void check_chain_sizes(void);
+void check_charset(void);
+void check_crc(void);
+void check_drift(void);
+void check_size(void);
+void check_writer(void);
@@ -0,0 +1,41 @@
+#pragma once
+
+// The transcript test/check-golden.c encodes, shared with the baseline
+// generator in test/baseline. Latin-1 only, which is all the baseline
+// encoder could convert.
+
+#include <stdint.h>
+
+// Transcript, with the time each line is given at, in milliseconds.
+struct Line
+{
+	uint64_t ms;
+	const char *text;
+};
+typedef struct Line Line;
+
+static const Line transcript[] = {
+	{500, "Boa noite.\n"},
+	{1200, "Começa agora o jornal da noite,\n"},
+	{2100, "com as notícias do dia.\n"},
+	{3400, "\n"},
+	{4000, "Ação, coração, pão e maçã: ÀÉÍÓÚ àéíóú ç ñ ü.\n"},
+	{5300, "Preço: R$ 12,50 (à vista) - 100% garantido!\n"},
+	{6000, "Olá, ¿qué tal? «Très bien», 25°C, ½ kg.\n"},
+	{7800, "\n"},
+	{8000, "\n"},
+	{9100, "[música]\n"},
+	{10500, "Uma linha bem comprida, que passa do que cabe na tela"
+		" e continua mesmo assim, para ver como fica.\n"},
+	{12000, "Fim.\n"},
+};
+#define NLINES (sizeof transcript / sizeof transcript[0])
+
+// Management is sent every this often, from time 0.
+#define MANAGEMENT_MS 2000
+
+// When the input ends, and a caption still pending is sent.
+#define END_MS 13000
+
+// Everything after the last line, when the screen is cleared.
+#define CLEAR_MS 14000
@@ -0,0 +1,50 @@
+#!/usr/bin/env python3
+# Generates src/jis-table.c, the JIS X 0208 code of every BMP code
+# point it holds, for charset.c. Run by make jis-table.
+#
+# EUC-JP is JIS X 0208 with both bytes OR 0x80, so decoding every
+# EUC-JP double byte tells which code point each JIS code stands for.
+
+import sys
+
+table = {}
+for row in range(0x21, 0x7f):
+    for col in range(0x21, 0x7f):
+        try:
+            text = bytes([row | 0x80, col | 0x80]).decode('euc_jp')
+        except UnicodeDecodeError:
+            continue
+        if len(text) != 1:
+            continue
+        cp = ord(text)
+        # The first code of a character wins, as in the JIS order.
+        if cp < 0x10000 and cp not in table:
+            table[cp] = row << 8 | col
+
+pages = sorted({cp >> 8 for cp in table})
+
+out = sys.stdout
+out.write('''// Generated by tools/gen-jis-table.py, do not edit.
+
+#include "jis-table.h"
+
+''')
+
+out.write('const uint8_t jis_page_index[256] = {\n')
+index = [0] * 256
+for i, page in enumerate(pages):
+    index[page] = i + 1
+for i in range(0, 256, 16):
+    out.write('\t' + ', '.join('%d' % n for n in index[i:i + 16]) + ',\n')
+out.write('};\n\n')
+
+out.write('const uint16_t jis_pages[%d][256] = {\n' % (len(pages) + 1))
+out.write('\t// No code point of a page without any.\n\t{0},\n')
+for page in pages:
+    out.write('\t// U+%02X00\n\t{\n' % page)
+    codes = [table.get(page << 8 | lo, 0) for lo in range(256)]
+    for i in range(0, 256, 8):
+        out.write('\t\t' + ', '.join('0x%04x' % c for c in codes[i:i + 8])
+            + ',\n')
+    out.write('\t},\n')
+out.write('};\n')
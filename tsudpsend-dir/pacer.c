@@ -0,0 +1,199 @@
+/*
+ * Datagram pacing for tsudpsend.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * Every datagram gets an absolute departure deadline, computed either
+ * from the bitrate and the bits sent so far, or from the PCRs found in
+ * the stream. The sender sleeps with clock_nanosleep(TIMER_ABSTIME) up
+ * to a short while before the deadline and spins the rest, so errors
+ * never accumulate from one datagram to the next.
+ */
+
+#include <string.h>
+#include <errno.h>
+#include <time.h>
+
+#include "pacer.h"
+
+#define TS_PACKET_SIZE 188
+#define PCR_WRAP ((1ULL << 33) * 300)
+/* departures later than this are counted as late */
+#define LATE_THRESHOLD_NS 100000LL
+/* PCR jumps bigger than this are taken as discontinuities */
+#define PCR_MAX_GAP_NS 1000000000LL
+
+static long long now_ns(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000000000LL + t.tv_nsec;
+}
+
+static void sleep_until(long long ns)
+{
+    struct timespec t;
+    t.tv_sec = ns / 1000000000LL;
+    t.tv_nsec = ns % 1000000000LL;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &t, NULL) == EINTR)
+	;
+}
+
+void pacer_init(struct pacer* p, unsigned int bitrate, int pcr_mode, long long spin_ns)
+{
+    memset(p, 0, sizeof(*p));
+    p->bitrate = bitrate;
+    p->spin_ns = spin_ns;
+    p->pcr_mode = pcr_mode;
+    p->pcr_pid = -1;
+    p->ns_per_byte = 8e9 / bitrate;
+    p->start_ns = now_ns();
+}
+
+/* offset of the first TS packet in data carrying a PCR of the PCR PID */
+static int find_pcr(struct pacer* p, const unsigned char* data, size_t len,
+    unsigned long long* pcr, size_t* offset)
+{
+    size_t i;
+    for (i = 0; i + TS_PACKET_SIZE <= len; i += TS_PACKET_SIZE) {
+	const unsigned char* ts = data + i;
+	int pid = ((ts[1] & 0x1f) << 8) | ts[2];
+	unsigned long long base;
+
+	if (ts[0] != 0x47 || !(ts[3] & 0x20) || ts[4] < 7 || !(ts[5] & 0x10)) {
+	    continue;
+	}
+	if (p->pcr_pid < 0) {
+	    p->pcr_pid = pid;
+	} else if (pid != p->pcr_pid) {
+	    continue;
+	}
+
+	base = ((unsigned long long)ts[6] << 25) | (ts[7] << 17) | (ts[8] << 9)
+	    | (ts[9] << 1) | (ts[10] >> 7);
+	*pcr = base * 300 + (((ts[10] & 1) << 8) | ts[11]);
+	*offset = i;
+	return 1;
+    }
+    return 0;
+}
+
+static long long bitrate_deadline(const struct pacer* p)
+{
+    /* split to keep sent_bits * 1e9 from overflowing */
+    return p->start_ns + (p->sent_bits / p->bitrate) * 1000000000LL
+	+ (p->sent_bits % p->bitrate) * 1000000000LL / p->bitrate;
+}
+
+static long long pcr_deadline(struct pacer* p, const unsigned char* data, size_t len)
+{
+    unsigned long long pcr;
+    size_t offset;
+    long long deadline;
+
+    if (!find_pcr(p, data, len, &pcr, &offset)) {
+	if (!p->have_pcr) {
+	    return bitrate_deadline(p);
+	}
+	deadline = p->last_pcr_deadline_ns + p->bytes_since_pcr * p->ns_per_byte;
+	p->bytes_since_pcr += len;
+	return deadline;
+    }
+
+    if (!p->have_pcr) {
+	deadline = bitrate_deadline(p) + offset * p->ns_per_byte;
+	p->have_pcr = 1;
+    } else {
+	unsigned long long ticks = (pcr + PCR_WRAP - p->last_pcr) % PCR_WRAP;
+	long long delta_ns = ticks * 1000 / 27;
+	unsigned long long bytes = p->bytes_since_pcr + offset;
+
+	if (delta_ns > PCR_MAX_GAP_NS || bytes == 0) {
+	    /* discontinuity, keep the current byte rate across it */
+	    deadline = p->last_pcr_deadline_ns + bytes * p->ns_per_byte;
+	} else {
+	    deadline = p->last_pcr_deadline_ns + delta_ns;
+	    p->ns_per_byte = (double)delta_ns / bytes;
+	}
+    }
+
+    p->last_pcr = pcr;
+    p->last_pcr_deadline_ns = deadline;
+    p->bytes_since_pcr = len - offset;
+
+    return deadline - offset * p->ns_per_byte;
+}
+
+void pacer_wait(struct pacer* p, const unsigned char* data, size_t len)
+{
+    long long deadline;
+    long long now;
+    long long dev;
+
+    if (p->pcr_mode) {
+	deadline = pcr_deadline(p, data, len);
+    } else {
+	deadline = bitrate_deadline(p);
+    }
+
+    now = now_ns();
+    if (deadline - p->spin_ns > now) {
+	sleep_until(deadline - p->spin_ns);
+    }
+    while ((now = now_ns()) < deadline)
+	;
+
+    dev = now - deadline;
+    p->total_dev_ns += dev;
+    if (dev > LATE_THRESHOLD_NS) {
+	++p->late;
+    }
+    if (dev > p->max_late_ns) {
+	p->max_late_ns = dev;
+    }
+
+    if (p->datagrams) {
+	long long jitter = (now - p->prev_departure_ns)
+	    - (deadline - p->prev_deadline_ns);
+	unsigned long long us = (jitter < 0 ? -jitter : jitter) / 1000;
+	int bucket = 0;
+	while (us && bucket < PACER_HIST_BUCKETS - 1) {
+	    us >>= 1;
+	    ++bucket;
+	}
+	++p->jitter_hist[bucket];
+    }
+
+    p->prev_deadline_ns = deadline;
+    p->prev_departure_ns = now;
+    p->sent_bits += len * 8;
+    ++p->datagrams;
+}
+
+void pacer_report(const struct pacer* p, FILE* out)
+{
+    int i;
+    int last = 0;
+
+    if (!p->datagrams) {
+	return;
+    }
+
+    fprintf(out, "%llu departures paced, %llu late by more than %lld us, "
+	"mean deviation %lld us, max late %lld us\n",
+	p->datagrams, p->late, LATE_THRESHOLD_NS / 1000,
+	p->total_dev_ns / (long long)p->datagrams / 1000, p->max_late_ns / 1000);
+
+    for (i = 0; i < PACER_HIST_BUCKETS; ++i) {
+	if (p->jitter_hist[i]) {
+	    last = i;
+	}
+    }
+    fprintf(out, "inter-departure jitter:\n");
+    for (i = 0; i <= last; ++i) {
+	fprintf(out, "  < %8llu us: %llu\n", 1ULL << i, p->jitter_hist[i]);
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * Datagram pacing for tsudpsend.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef PACER_H
+#define PACER_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+#define PACER_HIST_BUCKETS 24
+
+struct pacer {
+    long long start_ns;
+    unsigned long long bitrate;
+    unsigned long long sent_bits;
+    long long spin_ns;
+
+    /* PCR-derived pacing */
+    int pcr_mode;
+    int pcr_pid;
+    int have_pcr;
+    unsigned long long anchor_pcr;
+    long long anchor_ns;
+    unsigned long long last_pcr;
+    long long last_pcr_deadline_ns;
+    unsigned long long bytes_since_pcr;
+    double ns_per_byte;
+
+    long long prev_deadline_ns;
+    long long prev_departure_ns;
+
+    /* departure minus deadline */
+    unsigned long long datagrams;
+    unsigned long long late;
+    long long max_late_ns;
+    long long total_dev_ns;
+
+    /* |inter-departure interval - scheduled interval|, log2 microseconds */
+    unsigned long long jitter_hist[PACER_HIST_BUCKETS];
+};
+
+void pacer_init(struct pacer* p, unsigned int bitrate, int pcr_mode, long long spin_ns);
+
+/* blocks until the datagram in data may leave, len bytes of TS packets */
+void pacer_wait(struct pacer* p, const unsigned char* data, size_t len);
+
+void pacer_report(const struct pacer* p, FILE* out);
+
+#endif
@@ -0,0 +1,97 @@
+/*
+ * Lock-free ring of TS packets for tsudpsend's live mode.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ring.h"
+
+#define TS_PACKET_SIZE 188
+
+int ts_ring_init(struct ts_ring* r, size_t capacity)
+{
+    size_t c = 1;
+    while (c < capacity) {
+	c <<= 1;
+    }
+
+    memset(r, 0, sizeof(*r));
+    r->packets = malloc(c * TS_PACKET_SIZE);
+    if (!r->packets) {
+	return -1;
+    }
+    r->capacity = c;
+    atomic_init(&r->head, 0);
+    atomic_init(&r->tail, 0);
+    atomic_init(&r->closed, 0);
+    return 0;
+}
+
+void ts_ring_free(struct ts_ring* r)
+{
+    free(r->packets);
+    r->packets = NULL;
+}
+
+/* copies n packets between the ring, from position pos, and buf */
+static void copy_packets(struct ts_ring* r, size_t pos, unsigned char* buf,
+    size_t n, int to_ring)
+{
+    while (n) {
+	size_t slot = pos & (r->capacity - 1);
+	size_t run = r->capacity - slot;
+	unsigned char* p = r->packets + slot * TS_PACKET_SIZE;
+
+	if (run > n) {
+	    run = n;
+	}
+	if (to_ring) {
+	    memcpy(p, buf, run * TS_PACKET_SIZE);
+	} else {
+	    memcpy(buf, p, run * TS_PACKET_SIZE);
+	}
+	buf += run * TS_PACKET_SIZE;
+	pos += run;
+	n -= run;
+    }
+}
+
+size_t ts_ring_push(struct ts_ring* r, const unsigned char* packets, size_t n)
+{
+    size_t tail = atomic_load_explicit(&r->tail, memory_order_relaxed);
+    size_t head = atomic_load_explicit(&r->head, memory_order_acquire);
+    size_t room = r->capacity - (tail - head);
+
+    if (n > room) {
+	n = room;
+    }
+    copy_packets(r, tail, (unsigned char*)packets, n, 1);
+    /* publishes the packets to the consumer */
+    atomic_store_explicit(&r->tail, tail + n, memory_order_release);
+    return n;
+}
+
+size_t ts_ring_pop(struct ts_ring* r, unsigned char* packets, size_t n)
+{
+    size_t head = atomic_load_explicit(&r->head, memory_order_relaxed);
+    size_t tail = atomic_load_explicit(&r->tail, memory_order_acquire);
+
+    if (n > tail - head) {
+	n = tail - head;
+    }
+    copy_packets(r, head, packets, n, 0);
+    /* hands the slots back to the producer */
+    atomic_store_explicit(&r->head, head + n, memory_order_release);
+    return n;
+}
+
+size_t ts_ring_occupancy(struct ts_ring* r)
+{
+    return atomic_load(&r->tail) - atomic_load(&r->head);
+}
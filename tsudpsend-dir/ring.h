@@ -0,0 +1,42 @@
+/*
+ * Lock-free ring of TS packets for tsudpsend's live mode.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef RING_H
+#define RING_H
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+/*
+ * Single producer, single consumer. Positions only grow, the slot of
+ * packet number n being n % capacity; the producer alone moves tail,
+ * the consumer alone moves head.
+ */
+struct ts_ring {
+    unsigned char* packets;
+    size_t capacity;
+    _Atomic size_t head;
+    _Atomic size_t tail;
+    /* the producer won't push anything else */
+    _Atomic int closed;
+};
+
+/* capacity in TS packets, rounded up to a power of two */
+int ts_ring_init(struct ts_ring* r, size_t capacity);
+void ts_ring_free(struct ts_ring* r);
+
+/* copies up to n packets in, returns how many fit */
+size_t ts_ring_push(struct ts_ring* r, const unsigned char* packets, size_t n);
+
+/* copies up to n packets out, returns how many there were */
+size_t ts_ring_pop(struct ts_ring* r, unsigned char* packets, size_t n);
+
+size_t ts_ring_occupancy(struct ts_ring* r);
+
+#endif
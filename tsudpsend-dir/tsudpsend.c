@@ -18,6 +18,7 @@
 
 
 #define MULTICAST
+#define _GNU_SOURCE
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -25,38 +26,418 @@
 #include <fcntl.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <netinet/udp.h>
 #include <sys/types.h>
 #include <sys/time.h>
 #include <arpa/inet.h>
 #include <unistd.h>
 #include <time.h>
+#include <errno.h>
+#include <signal.h>
+#include <pthread.h>
+
+#include "pacer.h"
+#include "ring.h"
 
 #define TS_PACKET_SIZE 188
+#define MAX_GSO_SEGMENTS 64
+#define MAX_GSO_BYTES 65000
+
+#define TS_SYNC_BYTE 0x47
+/* live mode ring size default, in TS packets: about 1 s at 100 Mbps */
+#define LIVE_RING_PACKETS 65536
+/* packets the live reader reads at once */
+#define LIVE_READ_PACKETS 256
+
+static volatile sig_atomic_t interrupted = 0;
+static volatile sig_atomic_t report_requested = 0;
 
-long long int usecDiff(struct timespec* time_stop, struct timespec* time_start)
+static void on_signal(int sig)
 {
-	long long int temp = 0;
-	long long int utemp = 0;
-		   
-	if (time_stop && time_start) {
-		if (time_stop->tv_nsec >= time_start->tv_nsec) {
-			utemp = time_stop->tv_nsec - time_start->tv_nsec;    
-			temp = time_stop->tv_sec - time_start->tv_sec;
-		} else {
-			utemp = time_stop->tv_nsec + 1000000000 - time_start->tv_nsec;       
-			temp = time_stop->tv_sec - 1 - time_start->tv_sec;
-		}
-		if (temp >= 0 && utemp >= 0) {
-			temp = (temp * 1000000000) + utemp;
-        	} else {
-			fprintf(stderr, "start time %ld.%ld is after stop time %ld.%ld\n", time_start->tv_sec, time_start->tv_nsec, time_stop->tv_sec, time_stop->tv_nsec);
-			temp = -1;
+    (void)sig;
+    interrupted = 1;
+}
+
+static void on_report(int sig)
+{
+    (void)sig;
+    report_requested = 1;
+}
+
+/* reads until the buffer is full or the input ends */
+static ssize_t read_block(int fd, unsigned char* buf, size_t size)
+{
+    size_t count = 0;
+    while (count < size) {
+	ssize_t len = read(fd, buf + count, size - count);
+	if (len < 0) {
+	    if (errno == EINTR) {
+		continue;
+	    }
+	    return -1;
+	} else if (len == 0) {
+	    break;
+	}
+	count += len;
+    }
+    return count;
+}
+
+/*
+ * Batched mode: every datagram is filled with up to packet_size bytes of
+ * real TS packets, the input is read a whole batch at a time and the batch
+ * is submitted with sendmmsg(). With gso, each message is a super-datagram
+ * the kernel splits in packet_size datagrams (UDP_SEGMENT).
+ *
+ * Whatever leaves at one deadline leaves as a burst, so a batch is sent
+ * in slices of at most quantum_us worth of the bitrate, each at its own
+ * deadline, and no GSO message is larger than a slice. A slice is never
+ * less than one datagram.
+ */
+static int send_batched(int transport_fd, int sockfd, struct sockaddr_in* addr,
+    unsigned long int packet_size, unsigned int batch, int gso,
+    unsigned long quantum_us, struct pacer* pacer)
+{
+    unsigned long long int datagrams = 0;
+    unsigned long long int reads = 0;
+    unsigned long long int send_calls = 0;
+    unsigned int segments = 1;
+    size_t quantum_bytes;
+    size_t block_size = batch * packet_size;
+    unsigned char* block;
+    struct mmsghdr* msgs;
+    struct iovec* iovs;
+    char (*cmsg_bufs)[CMSG_SPACE(sizeof(uint16_t))];
+    int completed = 0;
+    int ret = 0;
+
+    if (gso) {
+	segments = MAX_GSO_BYTES / packet_size;
+	if (segments > MAX_GSO_SEGMENTS) {
+	    segments = MAX_GSO_SEGMENTS;
+	}
+	if (segments == 0) {
+	    segments = 1;
+	}
+    }
+
+    quantum_bytes = pacer->bitrate * quantum_us / 8000000;
+    quantum_bytes -= quantum_bytes % packet_size;
+    if (quantum_bytes < packet_size) {
+	quantum_bytes = packet_size;
+    }
+    if (segments * packet_size > quantum_bytes) {
+	segments = quantum_bytes / packet_size;
+    }
+    block_size *= segments;
+
+    block = malloc(block_size);
+    msgs = calloc(batch, sizeof(*msgs));
+    iovs = calloc(batch, sizeof(*iovs));
+    cmsg_bufs = calloc(batch, sizeof(*cmsg_bufs));
+
+    while (!completed && !interrupted) {
+	ssize_t len = read_block(transport_fd, block, block_size);
+	size_t offset = 0;
+	unsigned int nmsgs = 0;
+	unsigned int first;
+
+	++reads;
+	if (len < 0) {
+	    fprintf(stderr, "ts file read error \n");
+	    ret = -1;
+	    completed = 1;
+	    break;
+	}
+	len -= len % TS_PACKET_SIZE;
+	if (len == 0) {
+	    fprintf(stderr, "ts sent done\n");
+	    completed = 1;
+	    break;
+	}
+
+	while (offset < (size_t)len) {
+	    size_t msg_len = len - offset;
+	    if (msg_len > segments * packet_size) {
+		msg_len = segments * packet_size;
+	    }
+
+	    memset(&msgs[nmsgs], 0, sizeof(msgs[nmsgs]));
+	    iovs[nmsgs].iov_base = block + offset;
+	    iovs[nmsgs].iov_len = msg_len;
+	    msgs[nmsgs].msg_hdr.msg_name = addr;
+	    msgs[nmsgs].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+	    msgs[nmsgs].msg_hdr.msg_iov = &iovs[nmsgs];
+	    msgs[nmsgs].msg_hdr.msg_iovlen = 1;
+
+	    if (gso && msg_len > packet_size) {
+		struct cmsghdr* cm;
+		uint16_t segment_size = packet_size;
+
+		msgs[nmsgs].msg_hdr.msg_control = cmsg_bufs[nmsgs];
+		msgs[nmsgs].msg_hdr.msg_controllen = sizeof(cmsg_bufs[nmsgs]);
+		cm = CMSG_FIRSTHDR(&msgs[nmsgs].msg_hdr);
+		cm->cmsg_level = SOL_UDP;
+		cm->cmsg_type = UDP_SEGMENT;
+		cm->cmsg_len = CMSG_LEN(sizeof(segment_size));
+		memcpy(CMSG_DATA(cm), &segment_size, sizeof(segment_size));
+	    }
+
+	    datagrams += (msg_len + packet_size - 1) / packet_size;
+	    offset += msg_len;
+	    ++nmsgs;
+	}
+
+	/* each slice leaves at the deadline of its first datagram */
+	offset = 0;
+	for (first = 0; first < nmsgs && !completed; ) {
+	    unsigned int end = first + 1;
+	    size_t slice_len = iovs[first].iov_len;
+	    unsigned int i;
+
+	    while (end < nmsgs && slice_len + iovs[end].iov_len <= quantum_bytes) {
+		slice_len += iovs[end].iov_len;
+		++end;
+	    }
+
+	    pacer_wait(pacer, block + offset, slice_len);
+
+	    for (i = first; i < end; ) {
+		int sent = sendmmsg(sockfd, &msgs[i], end - i, 0);
+		++send_calls;
+		if (sent <= 0) {
+		    if (sent < 0 && errno == EINTR) {
+			continue;
+		    }
+		    perror("sendmmsg(): error ");
+		    ret = -1;
+		    completed = 1;
+		    break;
 		}
-	} else {
-		fprintf(stderr, "memory is garbaged?\n");
-		temp = -1;
+		i += sent;
+	    }
+	    offset += slice_len;
+	    first = end;
 	}
-        return temp / 1000;
+    }
+
+    fprintf(stderr, "%llu datagrams, %llu reads, %llu sendmmsg calls\n",
+	datagrams, reads, send_calls);
+
+    free(cmsg_bufs);
+    free(iovs);
+    free(msgs);
+    free(block);
+    return ret;
+}
+
+/*
+ * Live mode: a reader thread feeds the ring from a pipe, FIFO or stdin,
+ * realigning on sync bytes, while the main thread sends a datagram at
+ * every pacer deadline, filled up with null packets when the ring runs
+ * dry, so the output bitrate holds whatever the input does.
+ */
+struct live_reader {
+    int fd;
+    struct ts_ring* ring;
+
+    /* times sync was lost, and bytes dropped finding it again */
+    _Atomic unsigned long long resyncs;
+    _Atomic unsigned long long skipped_bytes;
+    /* times the ring was full and reading waited for the sender */
+    _Atomic unsigned long long full_waits;
+};
+
+struct live_stats {
+    unsigned long long datagrams;
+    /* datagrams that went out short of input, and nulls filling them */
+    unsigned long long underruns;
+    unsigned long long null_packets;
+    size_t max_occupancy;
+    unsigned long long total_occupancy;
+};
+
+/* first position from off that looks like the start of a packet: a sync
+ * byte, followed by another one a packet later if that's been read */
+static size_t find_sync(const unsigned char* buf, size_t off, size_t have)
+{
+    for (; off < have; ++off) {
+	if (buf[off] == TS_SYNC_BYTE && (off + TS_PACKET_SIZE >= have
+	    || buf[off + TS_PACKET_SIZE] == TS_SYNC_BYTE)) {
+	    break;
+	}
+    }
+    return off;
+}
+
+/* pushes n packets, waiting for room as long as it takes */
+static void push_all(struct live_reader* lr, const unsigned char* packets, size_t n)
+{
+    int waited = 0;
+    while (n && !interrupted) {
+	size_t pushed = ts_ring_push(lr->ring, packets, n);
+	packets += pushed * TS_PACKET_SIZE;
+	n -= pushed;
+	if (n) {
+	    /* backpressure: the input isn't read, so its writer blocks */
+	    struct timespec t = {0, 1000000};
+	    if (!waited) {
+		++lr->full_waits;
+		waited = 1;
+	    }
+	    nanosleep(&t, NULL);
+	}
+    }
+}
+
+static void* live_reader_main(void* arg)
+{
+    struct live_reader* lr = arg;
+    unsigned char buf[(LIVE_READ_PACKETS + 1) * TS_PACKET_SIZE];
+    size_t have = 0;
+    int in_sync = 1;
+
+    while (!interrupted) {
+	ssize_t len = read(lr->fd, buf + have, sizeof(buf) - have);
+	size_t off = 0;
+
+	if (len < 0) {
+	    if (errno == EINTR) {
+		continue;
+	    }
+	    perror("live input read error ");
+	    break;
+	} else if (len == 0) {
+	    break;
+	}
+	have += len;
+
+	while (have - off >= TS_PACKET_SIZE) {
+	    size_t run = off;
+
+	    /* the run of aligned packets from off */
+	    while (have - run >= TS_PACKET_SIZE && buf[run] == TS_SYNC_BYTE
+		&& (have - run < 2 * TS_PACKET_SIZE
+		    || buf[run + TS_PACKET_SIZE] == TS_SYNC_BYTE)) {
+		run += TS_PACKET_SIZE;
+	    }
+	    if (run > off) {
+		push_all(lr, buf + off, (run - off) / TS_PACKET_SIZE);
+		off = run;
+		in_sync = 1;
+		continue;
+	    }
+	    if (have - off < TS_PACKET_SIZE) {
+		break;
+	    }
+
+	    /* misaligned: drop bytes up to the next likely packet start */
+	    run = find_sync(buf, off + 1, have);
+	    if (in_sync) {
+		++lr->resyncs;
+		in_sync = 0;
+	    }
+	    lr->skipped_bytes += run - off;
+	    off = run;
+	}
+
+	memmove(buf, buf + off, have - off);
+	have -= off;
+    }
+
+    atomic_store(&lr->ring->closed, 1);
+    return NULL;
+}
+
+static void live_report(struct live_reader* lr, const struct live_stats* st, FILE* out)
+{
+    fprintf(out, "ring: %zu of %zu packets queued, max %zu, mean %llu\n",
+	ts_ring_occupancy(lr->ring), lr->ring->capacity, st->max_occupancy,
+	st->datagrams ? st->total_occupancy / st->datagrams : 0);
+    fprintf(out, "%llu datagrams, %llu underruns, %llu null packets inserted\n",
+	st->datagrams, st->underruns, st->null_packets);
+    fprintf(out, "%llu resyncs, %llu bytes skipped, %llu waits for a full ring\n",
+	(unsigned long long)lr->resyncs, (unsigned long long)lr->skipped_bytes,
+	(unsigned long long)lr->full_waits);
+}
+
+static int send_live(int transport_fd, int sockfd, struct sockaddr_in* addr,
+    unsigned long int packet_size, size_t ring_packets,
+    const unsigned char* null_packet, struct pacer* pacer)
+{
+    struct ts_ring ring;
+    struct live_reader lr;
+    struct live_stats st;
+    pthread_t reader;
+    size_t per_datagram = packet_size / TS_PACKET_SIZE;
+    unsigned char* send_buf;
+    int ret = 0;
+
+    if (ts_ring_init(&ring, ring_packets) < 0) {
+	fprintf(stderr, "can't allocate live ring\n");
+	return -1;
+    }
+    memset(&lr, 0, sizeof(lr));
+    memset(&st, 0, sizeof(st));
+    lr.fd = transport_fd;
+    lr.ring = &ring;
+    if (pthread_create(&reader, NULL, live_reader_main, &lr) != 0) {
+	fprintf(stderr, "can't start live reader\n");
+	ts_ring_free(&ring);
+	return -1;
+    }
+
+    send_buf = malloc(packet_size);
+    while (!interrupted) {
+	size_t occupancy = ts_ring_occupancy(&ring);
+	int closed = atomic_load(&ring.closed);
+	size_t n = ts_ring_pop(&ring, send_buf, per_datagram);
+	size_t i;
+
+	if (n == 0 && closed && ts_ring_occupancy(&ring) == 0) {
+	    fprintf(stderr, "ts sent done\n");
+	    break;
+	}
+	if (n < per_datagram) {
+	    ++st.underruns;
+	    st.null_packets += per_datagram - n;
+	    for (i = n; i < per_datagram; ++i) {
+		memcpy(send_buf + i * TS_PACKET_SIZE, null_packet, TS_PACKET_SIZE);
+	    }
+	}
+
+	if (occupancy > st.max_occupancy) {
+	    st.max_occupancy = occupancy;
+	}
+	st.total_occupancy += occupancy;
+	++st.datagrams;
+
+	pacer_wait(pacer, send_buf, packet_size);
+	if (sendto(sockfd, send_buf, packet_size, 0, (struct sockaddr *)addr,
+	    sizeof(struct sockaddr_in)) <= 0) {
+	    if (errno == EINTR) {
+		continue;
+	    }
+	    perror("send(): error ");
+	    ret = -1;
+	    break;
+	}
+
+	if (report_requested) {
+	    report_requested = 0;
+	    live_report(&lr, &st, stderr);
+	}
+    }
+
+    /* the reader may be waiting for room, or blocked reading */
+    interrupted = 1;
+    pthread_cancel(reader);
+    pthread_join(reader, NULL);
+    live_report(&lr, &st, stderr);
+
+    free(send_buf);
+    ts_ring_free(&ring);
+    return ret;
 }
 
 
@@ -75,22 +456,66 @@ int main (int argc, char *argv[]) {
     char* tsfile;
     unsigned char* send_buf;
     unsigned int bitrate;
-    unsigned long long int packet_time;
-    unsigned long long int real_time;    
-    struct timespec time_start;
-    struct timespec time_stop;
-    struct timespec nano_sleep_packet;
+    struct pacer pacer;
+    unsigned int batch = 0;
+    int gso = 0;
+    unsigned long quantum_us = 1000;
+    int pcr_mode = 0;
+    long long spin_ns = 50000;
+    int live = 0;
+    size_t ring_packets = LIVE_RING_PACKETS;
+    int opt;
     
     memset(&addr, 0, sizeof(addr));
-    memset(&time_start, 0, sizeof(time_start));
-    memset(&time_stop, 0, sizeof(time_stop));
-    memset(&nano_sleep_packet, 0, sizeof(nano_sleep_packet));
+
+    while ((opt = getopt(argc, argv, "+b:glpq:R:s:")) != -1) {
+	switch (opt) {
+	case 'b':
+	    batch = strtoul(optarg, 0, 0);
+	    break;
+	case 'g':
+	    gso = 1;
+	    break;
+	case 'l':
+	    live = 1;
+	    break;
+	case 'p':
+	    pcr_mode = 1;
+	    break;
+	case 'q':
+	    quantum_us = strtoul(optarg, 0, 0);
+	    break;
+	case 'R':
+	    ring_packets = strtoul(optarg, 0, 0);
+	    break;
+	case 's':
+	    spin_ns = strtoll(optarg, 0, 0) * 1000;
+	    break;
+	default:
+	    argc = 0;
+	}
+    }
+    if (gso && !batch) {
+	batch = 64;
+    }
+    if (argc > 0) {
+	argv[optind - 1] = argv[0];
+	argv += optind - 1;
+	argc -= optind - 1;
+    }
 
     if(argc < 5 ) {
-	fprintf(stderr, "Usage: %s file.ts ipaddr port bitrate [ts_packet_per_ip_packet] [udp_packet_ttl]\n", argv[0]);
+	fprintf(stderr, "Usage: %s [-b datagrams_per_call] [-g] [-l] [-p] [-q quantum_us] [-R ring_packets] [-s spin_us] file.ts ipaddr port bitrate [ts_packet_per_ip_packet] [udp_packet_ttl]\n", argv[0]);
 	fprintf(stderr, "ts_packet_per_ip_packet default is 7\n");
 	fprintf(stderr, "bit rate refers to transport stream bit rate\n");
 	fprintf(stderr, "zero bitrate is 100.000.000 bps\n");
+	fprintf(stderr, "-b fills every datagram with real TS packets and sends that many datagrams per sendmmsg call\n");
+	fprintf(stderr, "-g also lets the kernel segment the datagrams (UDP GSO), implies -b 64 if not given\n");
+	fprintf(stderr, "-l reads a live stream from file.ts, a pipe or FIFO, or - for stdin, and fills gaps with null packets\n");
+	fprintf(stderr, "-q caps what -b sends at one deadline to quantum_us of the bitrate, at least a datagram, default is 1000\n");
+	fprintf(stderr, "-R is the live mode buffer size in TS packets, default is %d\n", LIVE_RING_PACKETS);
+	fprintf(stderr, "-p paces by the PCRs in the stream, bitrate is only used until the first PCR\n");
+	fprintf(stderr, "-s busy waits the last spin_us before each departure, default is 50\n");
 	return 0;
     } else {
 	tsfile = argv[1];
@@ -133,13 +558,38 @@ int main (int argc, char *argv[]) {
 	
     }
     
-    transport_fd = open(tsfile, O_RDONLY);
+    if (live && strcmp(tsfile, "-") == 0) {
+	transport_fd = STDIN_FILENO;
+    } else {
+	transport_fd = open(tsfile, O_RDONLY);
+    }
     if(transport_fd < 0) {
 	fprintf(stderr, "can't open file %s\n", tsfile);
 	close(sockfd);
 	return 0;
     } 
     
+    signal(SIGINT, on_signal);
+    signal(SIGTERM, on_signal);
+    signal(SIGUSR1, on_report);
+    pacer_init(&pacer, bitrate, pcr_mode, spin_ns);
+
+    if (live) {
+	ret = send_live(transport_fd, sockfd, &addr, packet_size, ring_packets, null_ts, &pacer);
+	pacer_report(&pacer, stderr);
+	close(transport_fd);
+	close(sockfd);
+	return ret < 0;
+    }
+
+    if (batch) {
+	ret = send_batched(transport_fd, sockfd, &addr, packet_size, batch, gso, quantum_us, &pacer);
+	pacer_report(&pacer, stderr);
+	close(transport_fd);
+	close(sockfd);
+	return ret < 0;
+    }
+
     int completed = 0;
     send_buf = malloc(packet_size);
 
@@ -150,41 +600,28 @@ int main (int argc, char *argv[]) {
 	}
     }
 
-    packet_time = 0;
-    real_time = 0;
-    
-    nano_sleep_packet.tv_nsec = 665778; /* 1 packet at 100mbps*/
-
-    clock_gettime(CLOCK_MONOTONIC, &time_start);
-    
-    while (!completed) {
-    
-	    clock_gettime(CLOCK_MONOTONIC, &time_stop);
-	    real_time = usecDiff(&time_stop, &time_start);
-	    while (real_time * bitrate > packet_time * 1000000 && !completed) { /* theorical bits against sent bits */
-		len = read(transport_fd, send_buf, TS_PACKET_SIZE);
-		if(len < 0) {
-		    fprintf(stderr, "ts file read error \n");
-		    completed = 1;
-		} else if (len == 0) {
-		    fprintf(stderr, "ts sent done\n");
-	    	    completed = 1;
-		} else {
-		    sent = sendto(sockfd, send_buf, packet_size, 0, (struct sockaddr *)&addr, sizeof(struct sockaddr_in));
-		    if(sent <= 0) {
-			perror("send(): error ");
-			completed = 1;
-		    } else {
-			packet_time += packet_size * 8;
-		    }
-		}
+    while (!completed && !interrupted) {
+	len = read(transport_fd, send_buf, TS_PACKET_SIZE);
+	if(len < 0) {
+	    fprintf(stderr, "ts file read error \n");
+	    completed = 1;
+	} else if (len == 0) {
+	    fprintf(stderr, "ts sent done\n");
+	    completed = 1;
+	} else {
+	    pacer_wait(&pacer, send_buf, packet_size);
+	    sent = sendto(sockfd, send_buf, packet_size, 0, (struct sockaddr *)&addr, sizeof(struct sockaddr_in));
+	    if(sent <= 0) {
+		perror("send(): error ");
+		completed = 1;
 	    }
-	    nanosleep(&nano_sleep_packet, 0);
+	}
     }
 
+    pacer_report(&pacer, stderr);
+
     close(transport_fd);
     close(sockfd);
     free(send_buf);
     return 0;    
 }
-